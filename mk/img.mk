@@ -4,8 +4,8 @@ include $(CPP_ENVRULES)
 
 
 # Variables genéricas de compilación del proyecto
-PROJ_CXXFLAGS=-I$(CPP_INCLUDE)/alp
-PROJ_LDFLAGS=-L$(INSTALL_LIB) -lalp
+PROJ_CXXFLAGS=-I$(CPP_INCLUDE)/alp -pthread
+PROJ_LDFLAGS=-L$(INSTALL_LIB) -lalp -pthread
 
 include $(CPP_GENRULES)
 
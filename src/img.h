@@ -49,6 +49,23 @@
 // ----------
 #include "img_algorithm.h"  // Algoritmos genéricos de contenedores bidimensionales
 #include "img_draw.h"	    // Funciones de dibujo
+#include "img_integral.h"   // Imagen integral: sumas de rectángulos en O(1)
+#include "img_gradient.h"   // Gradientes de la imagen completa
+#include "img_components.h" // Componentes conexas
+#include "img_flood_fill.h" // Relleno de regiones
+#include "img_contour.h"    // Contornos (algoritmo de la muralla)
+#include "img_overlay.h"    // Capas transparentes para anotar imágenes
+#include "img_dirty.h"	    // Registro de las zonas modificadas
+#include "img_color_space.h" // HSV, HSL, YCbCr y Lab
+#include "img_quantize.h"   // Reducción del número de colores (paletas)
+#include "img_lut.h"	    // Tablas para ajustar el color (brillo, gamma...)
+#include "img_color_count.h" // Número de colores, frecuencias
+#include "img_diff.h"	    // Diferencias entre imágenes (con tolerancia)
+#include "img_quality.h"   // MSE, PSNR y SSIM
+#include "img_saturate.h"  // Devolver los colores al cubo (satura, reescala)
+#include "img_binary.h"    // Formato binario (cabecera + filas)
+#include "img_padded.h"    // Imágenes con borde (vecinos sin comprobaciones)
+#include "img_stencil.h"   // Recorrido con ventanas k x k
 
 // Que facilitan la lectura de código
 
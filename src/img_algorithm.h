@@ -121,6 +121,8 @@ private:
 
 
 // TODO: comentar esta (???) Para depurar usar test::print2D ???
+// Para pasar imágenes entre programas usar write_binario/read_binario
+// (img_binary.h): este formato de texto es enorme y lento de leer.
 inline std::ostream& operator<<(std::ostream& out, const Image& img)
 { 
     for(auto f = img.row_begin(); f!= img.row_end(); ++f)
@@ -0,0 +1,533 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Formato binario.
+ *
+ *   - COMENTARIOS: Las filas se procesan por bloques de unos 4 MB: los hilos
+ *	convierten las filas del bloque a bytes (o de bytes a pixeles) y el
+ *	bloque se escribe (o lee) con una única llamada a write (read).
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include "img_binary.h"
+#include "img_parallel.h"
+#include "img_saturate.h"   // esta_en_rango
+
+#include <alp_exception.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+namespace img{
+
+using Byte = std::uint8_t;
+
+static constexpr Byte version = 1;
+static constexpr std::size_t tam_cabecera = 16;
+static constexpr std::size_t tam_bloque = std::size_t{1} << 22; // bytes
+
+// Número máximo de pixeles de una imagen leída (16384 x 16384, unos 3 GB
+// en memoria). La cabecera viene de fuera: no se reserva lo que diga sin
+// más.
+static constexpr std::uint64_t max_pixeles = std::uint64_t{1} << 28;
+
+enum class Codificacion : Byte { rgb8 = 0, rgb32 = 1 };
+
+
+/***************************************************************************
+ *			    ENTEROS LITTLE ENDIAN
+ ***************************************************************************/
+static inline void escribe_u32(Byte* q, std::uint32_t x)
+{
+    q[0] = static_cast<Byte>(x);
+    q[1] = static_cast<Byte>(x >> 8);
+    q[2] = static_cast<Byte>(x >> 16);
+    q[3] = static_cast<Byte>(x >> 24);
+}
+
+static inline std::uint32_t lee_u32(const Byte* p)
+{
+    return  std::uint32_t{p[0]}	       | (std::uint32_t{p[1]} << 8) |
+	   (std::uint32_t{p[2]} << 16) | (std::uint32_t{p[3]} << 24);
+}
+
+static inline void escribe_i32(Byte* q, int x)
+{
+    if constexpr (std::endian::native == std::endian::little){
+	std::int32_t y = x;
+	std::memcpy(q, &y, 4);
+    }
+    else
+	escribe_u32(q, static_cast<std::uint32_t>(x));
+}
+
+static inline int lee_i32(const Byte* p)
+{
+    if constexpr (std::endian::native == std::endian::little){
+	std::int32_t y;
+	std::memcpy(&y, p, 4);
+	return y;
+    }
+    else
+	return static_cast<std::int32_t>(lee_u32(p));
+}
+
+
+
+/***************************************************************************
+ *				PIXELES
+ ***************************************************************************/
+template <Codificacion cod>
+struct Pixel_binario;
+
+template <>
+struct Pixel_binario<Codificacion::rgb8>{
+    static constexpr std::size_t size = 3;
+
+    static Byte* escribe(Byte* q, const ColorRGB& c)
+    {
+	q[0] = static_cast<Byte>(c.r);
+	q[1] = static_cast<Byte>(c.g);
+	q[2] = static_cast<Byte>(c.b);
+	return q + size;
+    }
+
+    static ColorRGB lee(const Byte* p)
+    { return ColorRGB{p[0], p[1], p[2]}; }
+};
+
+template <>
+struct Pixel_binario<Codificacion::rgb32>{
+    static constexpr std::size_t size = 12;
+
+    static Byte* escribe(Byte* q, const ColorRGB& c)
+    {
+	escribe_i32(q, c.r);
+	escribe_i32(q + 4, c.g);
+	escribe_i32(q + 8, c.b);
+	return q + size;
+    }
+
+    static ColorRGB lee(const Byte* p)
+    { return ColorRGB{lee_i32(p), lee_i32(p + 4), lee_i32(p + 8)}; }
+};
+
+
+// Fila sin comprimir
+template <Codificacion cod>
+static void escribe_fila(const ColorRGB* p, Ind n, Byte* q)
+{
+    for (Ind j = 0; j < n; ++j)
+	q = Pixel_binario<cod>::escribe(q, p[j]);
+}
+
+template <Codificacion cod>
+static void lee_fila(const Byte* p, Ind n, ColorRGB* q)
+{
+    for (Ind j = 0; j < n; ++j, p += Pixel_binario<cod>::size)
+	q[j] = Pixel_binario<cod>::lee(p);
+}
+
+
+// Tamaño máximo de una fila comprimida de n pixeles: cada repetición
+// ahorra al menos 2 bytes, que pagan su cabecera y la de los literales que
+// la preceden. Sobran las cabeceras de los bloques de 128 literales y la
+// del último bloque.
+template <Codificacion cod>
+static std::size_t max_fila_comprimida(Ind n)
+{ return n * Pixel_binario<cod>::size + n / 128 + 1; }
+
+
+// Fila comprimida (PackBits). Añade la fila, precedida de su tamaño, a res.
+template <Codificacion cod>
+static void comprime_fila(const ColorRGB* p, Ind n, std::vector<Byte>& res)
+{
+    using Pixel = Pixel_binario<cod>;
+
+    std::size_t ini = res.size();
+    res.resize(ini + 4 + max_fila_comprimida<cod>(n));
+    Byte* q0 = res.data() + ini + 4;
+    Byte* q = q0;
+
+    Ind j = 0;
+    while (j < n){
+	// ¿Repetición?
+	Ind r = 1;
+	while (j + r < n and r < 129 and p[j + r] == p[j])
+	    ++r;
+
+	if (r >= 2){
+	    *q++ = static_cast<Byte>(r + 126);
+	    q = Pixel::escribe(q, p[j]);
+	    j += r;
+	}
+	else{ // Literales: hasta el principio de la siguiente repetición
+	    Ind k = j + 1;
+	    while (k < n and k - j < 128 and 
+		   (k + 1 == n or p[k] != p[k + 1]))
+		++k;
+
+	    *q++ = static_cast<Byte>(k - j - 1);
+	    for (; j < k; ++j)
+		q = Pixel::escribe(q, p[j]);
+	}
+    }
+
+    std::size_t tam = q - q0;
+    escribe_u32(res.data() + ini, static_cast<std::uint32_t>(tam));
+    res.resize(ini + 4 + tam);
+}
+
+
+// Descomprime la fila [p, pe) en q (n pixeles). Devuelve false si los
+// datos no son correctos.
+template <Codificacion cod>
+static bool descomprime_fila(const Byte* p, const Byte* pe, Ind n, ColorRGB* q)
+{
+    using Pixel = Pixel_binario<cod>;
+
+    Ind j = 0;
+    while (p != pe){
+	Ind h = *p++;
+
+	if (h < 128){
+	    Ind k = h + 1;
+	    if (k > n - j or 
+		static_cast<std::size_t>(pe - p) < k * Pixel::size)
+		return false;
+
+	    for (; k > 0; --k, ++j, p += Pixel::size)
+		q[j] = Pixel::lee(p);
+	}
+	else{
+	    Ind k = h - 126;
+	    if (k > n - j or static_cast<std::size_t>(pe - p) < Pixel::size)
+		return false;
+
+	    std::fill(q + j, q + j + k, Pixel::lee(p));
+	    j += k;
+	    p += Pixel::size;
+	}
+    }
+
+    return j == n;
+}
+
+
+
+/***************************************************************************
+ *				ESCRITURA
+ ***************************************************************************/
+static void escribe(std::ostream& out, const Byte* p, std::size_t n)
+{
+    out.write(reinterpret_cast<const char*>(p), 
+		static_cast<std::streamsize>(n));
+    if (!out)
+	throw alp::Excepcion{"write_binario: error al escribir la imagen"};
+}
+
+
+template <Codificacion cod>
+static void write_sin_comprimir(const Image& img0, std::ostream& out)
+{
+    Ind rows = img0.rows();
+    Ind cols = img0.cols();
+
+    std::size_t tam_fila = cols * Pixel_binario<cod>::size;
+    Ind nfilas = static_cast<Ind>(std::max<std::size_t>(1, tam_bloque / tam_fila));
+    std::vector<Byte> buffer(std::min(nfilas, rows) * tam_fila);
+
+    for (Ind b0 = 0; b0 < rows; b0 += nfilas){
+	Ind be = std::min(rows, b0 + nfilas);
+
+	parallel_for(be - b0, [&](Ind i0, Ind ie){
+	    for (Ind i = i0; i < ie; ++i)
+		escribe_fila<cod>(&img0(b0 + i, 0), cols, 
+				  buffer.data() + i * tam_fila);
+	}, cols);
+
+	escribe(out, buffer.data(), (be - b0) * tam_fila);
+    }
+}
+
+
+template <Codificacion cod>
+static void write_rle(const Image& img0, std::ostream& out)
+{
+    Ind rows = img0.rows();
+    Ind cols = img0.cols();
+
+    std::size_t tam_fila = cols * Pixel_binario<cod>::size;
+    Ind nfilas = static_cast<Ind>(std::max<std::size_t>(1, tam_bloque / tam_fila));
+
+    // Cada fila se comprime en su vector
+    std::vector<std::vector<Byte>> filas(std::min(nfilas, rows));
+
+    for (Ind b0 = 0; b0 < rows; b0 += nfilas){
+	Ind be = std::min(rows, b0 + nfilas);
+
+	parallel_for(be - b0, [&](Ind i0, Ind ie){
+	    for (Ind i = i0; i < ie; ++i){
+		filas[i].clear();
+		comprime_fila<cod>(&img0(b0 + i, 0), cols, filas[i]);
+	    }
+	}, 2 * cols);
+
+	for (Ind i = 0; i < be - b0; ++i)
+	    escribe(out, filas[i].data(), filas[i].size());
+    }
+}
+
+
+void write_binario(const Image& img0, std::ostream& out, Compresion comp)
+{
+    Codificacion cod = esta_en_rango(img0)? Codificacion::rgb8
+					   : Codificacion::rgb32;
+
+    Byte cab[tam_cabecera] = {'I', 'M', 'G', 'B', version,
+			      static_cast<Byte>(cod), static_cast<Byte>(comp),
+			      0};
+    escribe_u32(cab + 8, static_cast<std::uint32_t>(img0.rows()));
+    escribe_u32(cab + 12, static_cast<std::uint32_t>(img0.cols()));
+    escribe(out, cab, tam_cabecera);
+
+    if (img0.rows() == 0 or img0.cols() == 0)
+	return;
+
+    if (comp == Compresion::rle){
+	if (cod == Codificacion::rgb8)
+	    write_rle<Codificacion::rgb8>(img0, out);
+	else
+	    write_rle<Codificacion::rgb32>(img0, out);
+    }
+    else{
+	if (cod == Codificacion::rgb8)
+	    write_sin_comprimir<Codificacion::rgb8>(img0, out);
+	else
+	    write_sin_comprimir<Codificacion::rgb32>(img0, out);
+    }
+}
+
+
+void write_binario(const Image& img0, const std::string& name, Compresion comp)
+{
+    std::ofstream out{name, std::ios::binary};
+    if (!out)
+	throw alp::Excepcion{"write_binario: no se puede crear " + name};
+
+    write_binario(img0, out, comp);
+}
+
+
+
+/***************************************************************************
+ *				LECTURA
+ ***************************************************************************/
+static void error_de_formato(const std::string& msg)
+{ throw alp::Error_de_formato{"read_binario: " + msg}; }
+
+static void lee(std::istream& in, Byte* p, std::size_t n)
+{
+    in.read(reinterpret_cast<char*>(p), static_cast<std::streamsize>(n));
+    if (static_cast<std::size_t>(in.gcount()) != n)
+	error_de_formato("faltan datos");
+}
+
+
+// Bytes que quedan por leer en in, o -1 si no se sabe (no se puede mover
+// uno por el flujo).
+static std::streamoff bytes_restantes(std::istream& in)
+{
+    std::streampos pos = in.tellg();
+    if (pos == std::streampos(-1))
+	return -1;
+
+    in.seekg(0, std::ios::end);
+    std::streampos fin = in.tellg();
+    in.clear();
+    in.seekg(pos);
+    if (!in or fin == std::streampos(-1))
+	error_de_formato("no se puede volver a la posición de lectura");
+
+    return fin - pos;
+}
+
+
+// Mínimo número de bytes que ocupan los datos de una imagen de
+// rows x cols: sin comprimir, todos los pixeles; comprimida, cada fila
+// con su tamaño y un bloque de repetición por cada 129 pixeles.
+static std::uint64_t tam_minimo(std::uint64_t rows, std::uint64_t cols,
+				Codificacion cod, Compresion comp)
+{
+    std::uint64_t tam_pixel = (cod == Codificacion::rgb8)?
+				    Pixel_binario<Codificacion::rgb8>::size :
+				    Pixel_binario<Codificacion::rgb32>::size;
+
+    if (rows == 0 or cols == 0)
+	return 0;
+
+    if (comp == Compresion::ninguna)
+	return rows * cols * tam_pixel;
+
+    return rows * (4 + (cols + 128) / 129 * (1 + tam_pixel));
+}
+
+
+template <Codificacion cod>
+static void read_sin_comprimir(std::istream& in, Image& img0)
+{
+    Ind rows = img0.rows();
+    Ind cols = img0.cols();
+
+    std::size_t tam_fila = cols * Pixel_binario<cod>::size;
+    Ind nfilas = static_cast<Ind>(std::max<std::size_t>(1, tam_bloque / tam_fila));
+    std::vector<Byte> buffer(std::min(nfilas, rows) * tam_fila);
+
+    for (Ind b0 = 0; b0 < rows; b0 += nfilas){
+	Ind be = std::min(rows, b0 + nfilas);
+
+	lee(in, buffer.data(), (be - b0) * tam_fila);
+
+	parallel_for(be - b0, [&](Ind i0, Ind ie){
+	    for (Ind i = i0; i < ie; ++i)
+		lee_fila<cod>(buffer.data() + i * tam_fila, cols, 
+			      &img0(b0 + i, 0));
+	}, cols);
+    }
+}
+
+
+template <Codificacion cod>
+static void read_rle(std::istream& in, Image& img0)
+{
+    Ind rows = img0.rows();
+    Ind cols = img0.cols();
+
+    std::size_t max_fila = max_fila_comprimida<cod>(cols);
+
+    std::vector<Byte> buffer;
+    std::vector<std::size_t> inicio;	// de cada fila en buffer
+
+    for (Ind b0 = 0; b0 < rows; ){
+	// Leemos filas hasta llenar el bloque
+	buffer.clear();
+	inicio.clear();
+	Ind be = b0;
+	while (be < rows and (be == b0 or buffer.size() < tam_bloque)){
+	    Byte tam[4];
+	    lee(in, tam, 4);
+	    std::size_t n = lee_u32(tam);
+	    if (n > max_fila)
+		error_de_formato("fila comprimida demasiado grande");
+
+	    inicio.push_back(buffer.size());
+	    buffer.resize(buffer.size() + n);
+	    lee(in, buffer.data() + inicio.back(), n);
+	    ++be;
+	}
+	inicio.push_back(buffer.size());
+
+	std::atomic<bool> ok{true};
+	parallel_for(be - b0, [&](Ind i0, Ind ie){
+	    for (Ind i = i0; i < ie; ++i)
+		if (!descomprime_fila<cod>(buffer.data() + inicio[i], 
+					   buffer.data() + inicio[i + 1],
+					   cols, &img0(b0 + i, 0)))
+		    ok = false;
+	}, 2 * cols);
+
+	if (!ok)
+	    error_de_formato("datos comprimidos incorrectos");
+
+	b0 = be;
+    }
+}
+
+
+Image read_binario(std::istream& in)
+{
+    Byte cab[tam_cabecera];
+    lee(in, cab, tam_cabecera);
+
+    if (cab[0] != 'I' or cab[1] != 'M' or cab[2] != 'G' or cab[3] != 'B')
+	error_de_formato("no es una imagen en formato binario");
+
+    if (cab[4] != version)
+	error_de_formato("versión desconocida");
+
+    if (cab[5] > static_cast<Byte>(Codificacion::rgb32))
+	error_de_formato("codificación desconocida");
+    Codificacion cod = static_cast<Codificacion>(cab[5]);
+
+    if (cab[6] > static_cast<Byte>(Compresion::rle))
+	error_de_formato("compresión desconocida");
+    Compresion comp = static_cast<Compresion>(cab[6]);
+
+    // rows * cols no se desborda: los dos son de 32 bits.
+    std::uint64_t rows = lee_u32(cab + 8);
+    std::uint64_t cols = lee_u32(cab + 12);
+    constexpr std::uint64_t max = std::numeric_limits<Ind>::max();
+    if (rows > max or cols > max or rows * cols > max_pixeles)
+	error_de_formato("tamaño incorrecto");
+
+    if (std::streamoff n = bytes_restantes(in);
+	n >= 0 and static_cast<std::uint64_t>(n) < tam_minimo(rows, cols, cod, comp))
+	error_de_formato("faltan datos");
+
+    Image img0{static_cast<Ind>(rows), static_cast<Ind>(cols)};
+    if (rows == 0 or cols == 0)
+	return img0;
+
+    if (comp == Compresion::rle){
+	if (cod == Codificacion::rgb8)
+	    read_rle<Codificacion::rgb8>(in, img0);
+	else
+	    read_rle<Codificacion::rgb32>(in, img0);
+    }
+    else{
+	if (cod == Codificacion::rgb8)
+	    read_sin_comprimir<Codificacion::rgb8>(in, img0);
+	else
+	    read_sin_comprimir<Codificacion::rgb32>(in, img0);
+    }
+
+    return img0;
+}
+
+
+Image read_binario(const std::string& name)
+{
+    std::ifstream in{name, std::ios::binary};
+    if (!in)
+	throw alp::File_cant_read{name};
+
+    return read_binario(in);
+}
+
+
+}// namespace img
+
@@ -0,0 +1,101 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#ifndef __IMG_BINARY_H__
+#define __IMG_BINARY_H__
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Formato binario para pasar imágenes entre programas.
+ *
+ *   - COMENTARIOS: operator<<(Image) escribe cada pixel como texto
+ *	"(rrr, ggg, bbb)": ocupa unas 15 veces más que los datos y leerlo
+ *	carácter a carácter es muy lento. Este formato guarda una cabecera y
+ *	a continuación las filas tal cual:
+ *
+ *	    write_binario(img, "tmp.imgb");
+ *	    Image img2 = read_binario("tmp.imgb");
+ *
+ *	o en un flujo cualquiera (abierto en modo binario):
+ *
+ *	    write_binario(img, out, Compresion::rle);
+ *	    Image img2 = read_binario(in);
+ *
+ *	Cabecera (16 bytes, enteros little endian):
+ *	    "IMGB"			    marca
+ *	    uint8_t  version		    = 1
+ *	    uint8_t  codificacion	    0 = rgb8, 1 = rgb32
+ *	    uint8_t  compresion		    0 = ninguna, 1 = rle
+ *	    uint8_t  reservado		    = 0
+ *	    uint32_t rows
+ *	    uint32_t cols
+ *
+ *	Codificación: si todos los pixeles están en el cubo de color cada
+ *	canal ocupa un byte (rgb8); si no (imágenes intermedias calculadas)
+ *	cada canal es un int32_t (rgb32). Nunca se pierde información.
+ *
+ *	Compresión rle (PackBits, por pixeles y por filas): cada fila empieza
+ *	con su tamaño en bytes (uint32_t) seguido de bloques que empiezan con
+ *	un byte h:
+ *	    + h < 128: siguen h + 1 pixeles distintos.
+ *	    + h >= 128: el siguiente pixel se repite h - 126 veces (2..129).
+ *	Útil con imágenes con zonas de color constante (máscaras, imágenes
+ *	cuantizadas, ...).
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include "img_image.h"
+
+namespace img{
+
+/// Compresión del formato binario.
+enum class Compresion : std::uint8_t { ninguna = 0, rle = 1 };
+
+
+/// Escribe img0 en formato binario en out (que tiene que estar abierto en
+/// modo binario). Si falla la escritura lanza una excepción.
+void write_binario(const Image& img0, std::ostream& out,
+		   Compresion comp = Compresion::ninguna);
+
+/// Escribe img0 en formato binario en el fichero 'name'.
+void write_binario(const Image& img0, const std::string& name,
+		   Compresion comp = Compresion::ninguna);
+
+
+/// Lee una imagen en formato binario de in. Si el formato no es correcto
+/// lanza alp::Error_de_formato. Antes de reservar la imagen comprueba que
+/// su tamaño sea razonable (como mucho 2^28 pixeles) y, si in admite
+/// seekg, que queden datos suficientes.
+Image read_binario(std::istream& in);
+
+/// Lee una imagen en formato binario del fichero 'name'.
+Image read_binario(const std::string& name);
+
+
+}// namespace img
+
+#endif
+
@@ -41,6 +41,7 @@
  ****************************************************************************/
 
 #include <limits>
+#include <cstdint>
 #include <alp_iterator.h>
 #include <alp_math.h>
 #include <limits>
@@ -52,7 +53,8 @@ namespace img{
 class Color 
 { 
 public:
-    // tipos de colores (añadir: intensidad, value, hue y saturate?)
+    // canales de un ColorRGB (hue, saturación, value... están en
+    // img_color_space.h)
     enum Tipo{red, green, blue};
 
 };
@@ -204,7 +206,8 @@ inline ColorRGB operator/(const ColorRGB& a, int n)
 
 /// Como ando experimentando, voy a operar con los colores. El resultado
 /// pudiera estar fuera del cubo de color. Esta función nos dice si 'c' es
-/// un color válido o no.
+/// un color válido o no (para toda una imagen: esta_en_rango, en
+/// img_saturate.h).
 inline bool is_color(const ColorRGB& c) 
 {return (img::is_color(c.r) && img::is_color(c.g) && img::is_color(c.b));}
 
@@ -234,6 +237,40 @@ inline bool son_distintos_t(const ColorRGB& c1, const ColorRGB& c2)
 inline constexpr int intensidad(const ColorRGB& c) {return (c.r +c.g +c.b)/3;}
 inline constexpr int intensidad_max() {return intensidad(ColorRGB{255,255,255});}
 
+/// Mezcla el color c con el fondo f: alfa = 0 devuelve f, alfa = 255
+/// devuelve c. Solo usa aritmética entera (redondea al más próximo).
+inline constexpr ColorRGB mezcla(const ColorRGB& f, const ColorRGB& c, int alfa)
+{
+    int beta = 255 - alfa;
+    return ColorRGB{(c.r * alfa + f.r * beta + 127) / 255,
+		    (c.g * alfa + f.g * beta + 127) / 255,
+		    (c.b * alfa + f.b * beta + 127) / 255};
+}
+
+
+/// Clave de 24 bits del color: 0xRRGGBB. Cada canal se recorta al rango
+/// de Color. Los colores se pueden ordenar y contar por su clave.
+inline constexpr std::uint32_t clave(const ColorRGB& c)
+{
+    constexpr int cmin = std::numeric_limits<Color>::min();
+    constexpr int cmax = std::numeric_limits<Color>::max();
+    static_assert(0 <= cmin and cmax <= 0xFF,
+		  "clave: cada canal tiene que caber en 8 bits");
+
+    auto canal = [](int x) {
+	return static_cast<std::uint32_t>(x < cmin? cmin: (x > cmax? cmax: x)); };
+
+    return (canal(c.r) << 16) | (canal(c.g) << 8) | canal(c.b);
+}
+
+/// Color de clave k (inversa de clave).
+inline constexpr ColorRGB color_de_clave(std::uint32_t k)
+{
+    return ColorRGB{static_cast<int>((k >> 16) & 0xFF),
+		    static_cast<int>((k >> 8) & 0xFF),
+		    static_cast<int>(k & 0xFF)};
+}
+
 
 /// Escribimos un color en formato txt
 std::ostream& operator<<(std::ostream& out, const ColorRGB& c);
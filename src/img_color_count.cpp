@@ -0,0 +1,250 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Cuenta de colores.
+ *
+ *   - COMENTARIOS: El radix sort ordena las claves en 3 pasadas de 8 bits.
+ *	En cada pasada el vector se divide en tantos trozos como hilos:
+ *	    1. Cada hilo cuenta cuántas claves de su trozo tienen cada dígito.
+ *	    2. Con esas cuentas se calcula dónde escribe cada hilo cada
+ *	       dígito (primero todos los 0 del trozo 0, luego los del trozo
+ *	       1, ...).
+ *	    3. Cada hilo copia su trozo a su sitio.
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include "img_color_count.h"
+#include "img_parallel.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <mutex>
+
+namespace img{
+
+static constexpr std::size_t nbloques = (std::size_t{1} << 24) / 64;
+
+Colores_presentes::Colores_presentes()
+    : bits_(nbloques, 0)
+{ }
+
+
+void Colores_presentes::une(const Colores_presentes& x)
+{
+    for (std::size_t k = 0; k < nbloques; ++k)
+	bits_[k] |= x.bits_[k];
+}
+
+
+std::size_t Colores_presentes::size() const
+{
+    std::size_t n = 0;
+    for (std::uint64_t b: bits_)
+	n += std::popcount(b);
+
+    return n;
+}
+
+
+template <typename Img>
+static Colores_presentes colores_presentes_(const Img& img0)
+{
+    Ind cols = img0.cols();
+    Colores_presentes res;
+    std::mutex m;
+
+    if (cols == 0)
+	return res;
+
+    // Si hay varias bandas cada una usa su conjunto (2 MB) y al final se
+    // unen.
+    bool una_banda = true;
+    parallel_for(img0.rows(), [&](Ind i0, Ind ie){
+	Colores_presentes banda;
+
+	for (Ind i = i0; i < ie; ++i){
+	    const ColorRGB* p = &img0(i, 0);
+	    for (Ind j = 0; j < cols; ++j)
+		banda.inserta(p[j]);
+	}
+
+	std::lock_guard<std::mutex> lock{m};
+	if (una_banda){
+	    std::swap(res, banda);
+	    una_banda = false;
+	}
+	else
+	    res.une(banda);
+    }, cols);
+
+    return res;
+}
+
+
+Colores_presentes colores_presentes(const Image& img0)
+{ return colores_presentes_(img0); }
+
+Colores_presentes colores_presentes(const Subimage& img0)
+{ return colores_presentes_(img0); }
+
+
+std::size_t num_colores(const Image& img0)
+{ return colores_presentes(img0).size(); }
+
+std::size_t num_colores(const Subimage& img0)
+{ return colores_presentes(img0).size(); }
+
+
+
+// ordena_claves
+// -------------
+void ordena_claves(std::vector<std::uint32_t>& v)
+{
+    Ind n = static_cast<Ind>(v.size());
+    if (n <= 1)
+	return;
+
+    // Trozos [ini[t], ini[t + 1])
+    Ind ntrozos = std::clamp<Ind>(n / parallel_min_elementos, 1,
+				  static_cast<Ind>(num_threads()));
+    std::vector<Ind> ini(ntrozos + 1);
+    for (Ind t = 0; t <= ntrozos; ++t)
+	ini[t] = static_cast<Ind>((static_cast<long long>(n) * t) / ntrozos);
+
+    std::vector<std::uint32_t> tmp(v.size());
+    std::vector<std::array<Ind, 256>> pos(ntrozos);
+
+    for (int desp = 0; desp < 24; desp += 8){
+	// 1. Cuentas
+	parallel_for(ntrozos, [&](Ind t0, Ind te){
+	    for (Ind t = t0; t < te; ++t){
+		pos[t].fill(0);
+		for (Ind k = ini[t]; k < ini[t + 1]; ++k)
+		    ++pos[t][(v[k] >> desp) & 0xFF];
+	    }
+	}, parallel_min_elementos);
+
+	// 2. Posiciones
+	Ind acumulado = 0;
+	for (int d = 0; d < 256; ++d)
+	    for (Ind t = 0; t < ntrozos; ++t){
+		Ind c = pos[t][d];
+		pos[t][d] = acumulado;
+		acumulado += c;
+	    }
+
+	// 3. Copia
+	parallel_for(ntrozos, [&](Ind t0, Ind te){
+	    for (Ind t = t0; t < te; ++t)
+		for (Ind k = ini[t]; k < ini[t + 1]; ++k)
+		    tmp[pos[t][(v[k] >> desp) & 0xFF]++] = v[k];
+	}, parallel_min_elementos);
+
+	std::swap(v, tmp);
+    }
+}
+
+
+
+// frecuencias
+// -----------
+template <typename Img>
+static std::vector<std::uint32_t> claves(const Img& img0)
+{
+    Ind rows = img0.rows();
+    Ind cols = img0.cols();
+    std::vector<std::uint32_t> res(static_cast<std::size_t>(rows) * cols);
+
+    if (cols == 0)
+	return res;
+
+    parallel_for(rows, [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i){
+	    const ColorRGB* p = &img0(i, 0);
+	    std::uint32_t* q = &res[static_cast<std::size_t>(i) * cols];
+	    for (Ind j = 0; j < cols; ++j)
+		q[j] = clave(p[j]);
+	}
+    }, cols);
+
+    return res;
+}
+
+
+template <typename Img>
+static std::vector<Frecuencia_color> frecuencias_(const Img& img0)
+{
+    std::vector<std::uint32_t> v = claves(img0);
+    ordena_claves(v);
+
+    std::vector<Frecuencia_color> res;
+    for (std::size_t k = 0; k < v.size(); ){
+	std::size_t k0 = k;
+	while (k < v.size() and v[k] == v[k0])
+	    ++k;
+
+	res.push_back(Frecuencia_color{color_de_clave(v[k0]), k - k0});
+    }
+
+    return res;
+}
+
+
+std::vector<Frecuencia_color> frecuencias(const Image& img0)
+{ return frecuencias_(img0); }
+
+std::vector<Frecuencia_color> frecuencias(const Subimage& img0)
+{ return frecuencias_(img0); }
+
+
+
+// colores_dominantes
+// ------------------
+static std::vector<Frecuencia_color>
+	    los_k_mayores(std::vector<Frecuencia_color> fs, size_t k)
+{
+    k = std::min(k, fs.size());
+
+    // fs está ordenado por clave: partial_sort no es estable, así que
+    // desempatamos por la clave explícitamente.
+    std::partial_sort(fs.begin(), fs.begin() + k, fs.end(),
+	[](const Frecuencia_color& a, const Frecuencia_color& b){
+	    if (a.n != b.n)
+		return a.n > b.n;
+	    return clave(a.color) < clave(b.color);
+	});
+
+    fs.resize(k);
+    return fs;
+}
+
+
+std::vector<Frecuencia_color> colores_dominantes(const Image& img0, size_t k)
+{ return los_k_mayores(frecuencias(img0), k); }
+
+std::vector<Frecuencia_color> colores_dominantes(const Subimage& img0, size_t k)
+{ return los_k_mayores(frecuencias(img0), k); }
+
+
+}// namespace img
@@ -0,0 +1,118 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#ifndef __IMG_COLOR_COUNT_H__
+#define __IMG_COLOR_COUNT_H__
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Cuenta los colores de una imagen.
+ *
+ *   - COMENTARIOS: Todo se hace con la clave de 24 bits de cada color
+ *	(clave(c) = 0xRRGGBB), sin comparar ColorRGB:
+ *
+ *	    + num_colores: número de colores distintos. Usa un mapa de bits
+ *	      con un bit por cada posible color (2^24 bits = 2 MB).
+ *
+ *	    + frecuencias: cuántas veces aparece cada color. Ordena las
+ *	      claves con radix sort (lineal) y cuenta las repeticiones.
+ *
+ *	    + colores_dominantes: los k colores que más aparecen.
+ *
+ *	Todos reparten el trabajo entre los hilos.
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "img_image.h"
+#include "img_color.h"
+#include "img_view.h"	// Subimage
+
+namespace img{
+
+/*!
+ *  \brief  Conjunto de colores: un bit por cada uno de los 2^24 colores.
+ *
+ */
+class Colores_presentes{
+public:
+    /// Conjunto vacío.
+    Colores_presentes();
+
+    void inserta(const ColorRGB& c) {inserta(clave(c));}
+    void inserta(std::uint32_t k)
+    { bits_[k >> 6] |= std::uint64_t{1} << (k & 63); }
+
+    bool contiene(const ColorRGB& c) const {return contiene(clave(c));}
+    bool contiene(std::uint32_t k) const
+    { return (bits_[k >> 6] >> (k & 63)) & 1; }
+
+    /// Añade todos los colores de x.
+    void une(const Colores_presentes& x);
+
+    /// Número de colores del conjunto.
+    std::size_t size() const;
+
+private:
+    std::vector<std::uint64_t> bits_;   // 2^24 / 64
+};
+
+
+/// Colores que aparecen en img0.
+Colores_presentes colores_presentes(const Image& img0);
+Colores_presentes colores_presentes(const Subimage& img0);
+
+/// Número de colores distintos de img0.
+std::size_t num_colores(const Image& img0);
+std::size_t num_colores(const Subimage& img0);
+
+
+/// Un color y el número de veces que aparece.
+struct Frecuencia_color{
+    ColorRGB color;
+    std::size_t n;
+};
+
+
+/// Colores de img0 con el número de veces que aparece cada uno, ordenados
+/// por clave.
+std::vector<Frecuencia_color> frecuencias(const Image& img0);
+std::vector<Frecuencia_color> frecuencias(const Subimage& img0);
+
+
+/// Los k colores que más aparecen en img0, de más a menos frecuente (a
+/// igualdad de frecuencia, por clave).
+std::vector<Frecuencia_color> colores_dominantes(const Image& img0, size_t k);
+std::vector<Frecuencia_color> colores_dominantes(const Subimage& img0, size_t k);
+
+
+/// Ordena las claves (de 24 bits) con radix sort.
+void ordena_claves(std::vector<std::uint32_t>& v);
+
+
+}// namespace img
+
+#endif
+
@@ -0,0 +1,195 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Conversión entre espacios de color.
+ *
+ *   - COMENTARIOS: RGB -> HSV y HSL están en línea en la cabecera.
+ *
+ *	Para Lab la tabla es la de la corrección gamma de sRGB (solo hay 256
+ *	valores posibles). El resto se calcula en float.
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include "img_color_space.h"
+
+#include <array>
+#include <cmath>
+
+namespace img{
+
+using impl_of::a_8bits;
+using impl_of::redondea16;
+
+// Color con tono h, croma C y mínimo m (todos en [0, 255])
+static ColorRGB desde_hue(int h, int C, int m)
+{
+    h = ((h % 360) + 360) % 360;
+    int sector = h / 60;
+    int f = h % 60;
+    int X = (C * ((sector % 2 == 0)? f: 60 - f) + 30) / 60;
+
+    int r, g, b;
+    switch (sector){
+	case 0 : r = C; g = X; b = 0; break;
+	case 1 : r = X; g = C; b = 0; break;
+	case 2 : r = 0; g = C; b = X; break;
+	case 3 : r = 0; g = X; b = C; break;
+	case 4 : r = X; g = 0; b = C; break;
+	default: r = C; g = 0; b = X; break;
+    }
+
+    return ColorRGB{a_8bits(r + m), a_8bits(g + m), a_8bits(b + m)};
+}
+
+
+
+// HSV
+// ---
+ColorRGB rgb(const ColorHSV& c)
+{
+    int s = a_8bits(c.s);
+    int v = a_8bits(c.v);
+
+    int C = (v * s + 127) / 255;
+
+    return desde_hue(c.h, C, v - C);
+}
+
+
+
+// HSL
+// ---
+ColorRGB rgb(const ColorHSL& c)
+{
+    int s = a_8bits(c.s);
+    int l = a_8bits(c.l);
+
+    // C = (1 - |2l - 1|) * s
+    int l2 = 2*l;
+    int C = (((l2 <= 255)? l2: 510 - l2) * s + 127) / 255;
+
+    return desde_hue(c.h, C, l - C / 2);
+}
+
+
+
+// Lab
+// ---
+// sRGB -> XYZ (D65)
+static constexpr float M[3][3] = {
+    {0.4124564f, 0.3575761f, 0.1804375f},
+    {0.2126729f, 0.7151522f, 0.0721750f},
+    {0.0193339f, 0.1191920f, 0.9503041f}};
+
+// XYZ -> sRGB
+static constexpr float Minv[3][3] = {
+    { 3.2404542f, -1.5371385f, -0.4985314f},
+    {-0.9692660f,  1.8760108f,  0.0415560f},
+    { 0.0556434f, -0.2040259f,  1.0572252f}};
+
+// Blanco de referencia: el blanco de sRGB (así a = b = 0 en los grises)
+static constexpr float Xn = M[0][0] + M[0][1] + M[0][2];
+static constexpr float Yn = M[1][0] + M[1][1] + M[1][2];
+static constexpr float Zn = M[2][0] + M[2][1] + M[2][2];
+
+static constexpr float delta = 6.0f / 29.0f;
+
+
+// lineal[x] = componente lineal del valor x de sRGB
+static const std::array<float, 256>& lineal()
+{
+    static const std::array<float, 256> tabla = []{
+	std::array<float, 256> t{};
+	for (int x = 0; x < 256; ++x){
+	    float c = x / 255.0f;
+	    t[x] = (c <= 0.04045f)? c / 12.92f
+				  : std::pow((c + 0.055f) / 1.055f, 2.4f);
+	}
+	return t;
+    }();
+
+    return tabla;
+}
+
+
+static inline float f_lab(float t)
+{
+    return (t > delta * delta * delta)? std::cbrt(t)
+				      : t / (3.0f * delta * delta) + 4.0f / 29.0f;
+}
+
+static inline float f_lab_inv(float f)
+{
+    return (f > delta)? f * f * f
+		      : 3.0f * delta * delta * (f - 4.0f / 29.0f);
+}
+
+static inline int redondea(float x)
+{ return static_cast<int>(std::lround(x)); }
+
+static inline int a_srgb(float c)
+{
+    c = (c <= 0.0031308f)? 12.92f * c
+			 : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+    return a_8bits(redondea(c * 255.0f));
+}
+
+
+ColorLab lab(const ColorRGB& c0)
+{
+    const auto& lin = lineal();
+    float r = lin[a_8bits(c0.r)];
+    float g = lin[a_8bits(c0.g)];
+    float b = lin[a_8bits(c0.b)];
+
+    float fx = f_lab((M[0][0] * r + M[0][1] * g + M[0][2] * b) / Xn);
+    float fy = f_lab((M[1][0] * r + M[1][1] * g + M[1][2] * b) / Yn);
+    float fz = f_lab((M[2][0] * r + M[2][1] * g + M[2][2] * b) / Zn);
+
+    float L = 116.0f * fy - 16.0f;
+
+    return ColorLab{a_8bits(redondea(L * 255.0f / 100.0f)),
+		    a_8bits(redondea(500.0f * (fx - fy)) + 128),
+		    a_8bits(redondea(200.0f * (fy - fz)) + 128)};
+}
+
+
+ColorRGB rgb(const ColorLab& c)
+{
+    float L = c.L * 100.0f / 255.0f;
+    float a = static_cast<float>(c.a - 128);
+    float b = static_cast<float>(c.b - 128);
+
+    float fy = (L + 16.0f) / 116.0f;
+    float X = Xn * f_lab_inv(fy + a / 500.0f);
+    float Y = Yn * f_lab_inv(fy);
+    float Z = Zn * f_lab_inv(fy - b / 200.0f);
+
+    return ColorRGB{a_srgb(Minv[0][0] * X + Minv[0][1] * Y + Minv[0][2] * Z),
+		    a_srgb(Minv[1][0] * X + Minv[1][1] * Y + Minv[1][2] * Z),
+		    a_srgb(Minv[2][0] * X + Minv[2][1] * Y + Minv[2][2] * Z)};
+}
+
+
+}// namespace img
+
@@ -0,0 +1,531 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#ifndef __IMG_COLOR_SPACE_H__
+#define __IMG_COLOR_SPACE_H__
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Otros espacios de color: HSV, HSL, YCbCr y Lab.
+ *
+ *   - COMENTARIOS: Igual que ColorRGB, todas las coordenadas son int. Los
+ *	rangos son:
+ *
+ *	    ColorHSV  : h en [0, 360) (grados), s y v en [0, 255]
+ *	    ColorHSL  : h en [0, 360) (grados), s y l en [0, 255]
+ *	    ColorYCbCr: y, cb y cr en [0, 255] (rango completo, como JPEG;
+ *			cb = cr = 128 en los grises)
+ *	    ColorLab  : CIE L*a*b* (D65) codificado en 8 bits:
+ *			L = L* * 255/100, a = a* + 128, b = b* + 128
+ *			(la misma codificación que usa OpenCV)
+ *
+ *	Para cada espacio hay una función que convierte un pixel y otras que
+ *	convierten toda la imagen, repartiendo las filas entre los hilos:
+ *
+ *	    ColorHSV c = hsv(ColorRGB::naranja());
+ *	    ColorRGB x = rgb(c);
+ *
+ *	    ImageHSV img_hsv = imagen_hsv(img);	    // pixeles (h, s, v)
+ *	    Planos p = planos_hsv(img);		    // 3 planos: h, s, v
+ *	    Image img1 = imagen_rgb(img_hsv);
+ *
+ *	plano_intensidad calcula la imagen en grises (8 o 16 bits) en un
+ *	plano contiguo:
+ *
+ *	    Plane<std::uint8_t> gris = plano_intensidad(img);
+ *	    auto luma = plano_intensidad<std::uint16_t>(img, Pesos_gris::bt709);
+ *
+ *	Evitamos los float donde podemos: YCbCr se calcula en coma fija y
+ *	HSV y HSL usan una tabla con los inversos de los denominadores. RGB
+ *	-> YCbCr, HSV y HSL son funciones en línea sin saltos (el tono elige
+ *	con selecciones, no con if): en Image y Subimage cada fila es un
+ *	bucle sobre un puntero que el compilador puede vectorizar.
+ *
+ *	Lab se calcula pixel a pixel en float (cbrt y pow, con una tabla para
+ *	la corrección gamma de sRGB): no se vectoriza. Tampoco las
+ *	conversiones a RGB, que eligen el sector del tono con un switch.
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+#include "img_image.h"
+#include "img_color.h"
+#include "img_view.h"	// Subimage
+#include "img_parallel.h"
+
+namespace img{
+
+/***************************************************************************
+ *			    COLORES
+ ***************************************************************************/
+struct ColorHSV{
+    using value_type = int;
+    static constexpr int ncolors = 3;
+
+    value_type h, s, v;
+};
+
+struct ColorHSL{
+    using value_type = int;
+    static constexpr int ncolors = 3;
+
+    value_type h, s, l;
+};
+
+struct ColorYCbCr{
+    using value_type = int;
+    static constexpr int ncolors = 3;
+
+    value_type y, cb, cr;
+};
+
+struct ColorLab{
+    using value_type = int;
+    static constexpr int ncolors = 3;
+
+    value_type L, a, b;
+};
+
+inline bool operator==(const ColorHSV& x, const ColorHSV& y)
+{ return x.h == y.h and x.s == y.s and x.v == y.v; }
+
+inline bool operator==(const ColorHSL& x, const ColorHSL& y)
+{ return x.h == y.h and x.s == y.s and x.l == y.l; }
+
+inline bool operator==(const ColorYCbCr& x, const ColorYCbCr& y)
+{ return x.y == y.y and x.cb == y.cb and x.cr == y.cr; }
+
+inline bool operator==(const ColorLab& x, const ColorLab& y)
+{ return x.L == y.L and x.a == y.a and x.b == y.b; }
+
+
+/// Coeficientes de la conversión RGB -> YCbCr.
+enum class Norma_ycbcr {
+    bt601,  // televisión estándar, JPEG
+    bt709   // alta definición
+};
+
+
+
+/***************************************************************************
+ *			CONVERSIÓN DE UN PIXEL
+ ***************************************************************************/
+// Los ColorRGB con coordenadas fuera de [0, 255] se recortan antes de
+// convertirlos.
+
+ColorRGB rgb(const ColorHSV& c);
+ColorRGB rgb(const ColorHSL& c);
+
+ColorLab lab(const ColorRGB& c);
+ColorRGB rgb(const ColorLab& c);
+
+
+namespace impl_of{
+// Coeficientes de YCbCr en coma fija (x 2^16). Ajustamos el coeficiente
+// de g para que los de y sumen exactamente 2^16 y los de cb y cr 0: así
+// los grises van a (x, 128, 128) sin errores de redondeo.
+struct Coef_ycbcr{
+    int yr, yg, yb;
+    int cbr, cbg, cbb;
+    int crr, crg, crb;
+    int r_cr, g_cb, g_cr, b_cb;	// inversa
+};
+
+constexpr int coma_fija(double x)
+{ return static_cast<int>(x * 65536.0 + (x < 0? -0.5: 0.5)); }
+
+constexpr Coef_ycbcr coef_ycbcr(double kr, double kb)
+{
+    double kg = 1.0 - kr - kb;
+    Coef_ycbcr c{};
+
+    c.yr = coma_fija(kr);
+    c.yb = coma_fija(kb);
+    c.yg = 65536 - c.yr - c.yb;
+
+    c.cbr = coma_fija(-0.5 * kr / (1.0 - kb));
+    c.cbb = coma_fija(0.5);
+    c.cbg = -c.cbr - c.cbb;
+
+    c.crr = coma_fija(0.5);
+    c.crb = coma_fija(-0.5 * kb / (1.0 - kr));
+    c.crg = -c.crr - c.crb;
+
+    c.r_cr = coma_fija(2.0 * (1.0 - kr));
+    c.g_cb = coma_fija(-2.0 * kb * (1.0 - kb) / kg);
+    c.g_cr = coma_fija(-2.0 * kr * (1.0 - kr) / kg);
+    c.b_cb = coma_fija(2.0 * (1.0 - kb));
+
+    return c;
+}
+
+inline constexpr Coef_ycbcr coef_bt601 = coef_ycbcr(0.299, 0.114);
+inline constexpr Coef_ycbcr coef_bt709 = coef_ycbcr(0.2126, 0.0722);
+
+inline constexpr const Coef_ycbcr& coef(Norma_ycbcr n)
+{ return (n == Norma_ycbcr::bt601)? coef_bt601: coef_bt709; }
+
+inline constexpr int a_8bits(int x)
+{ return std::clamp(x, 0, 255); }
+
+// Redondea x / 2^16
+inline constexpr int redondea16(int x)
+{ return (x + 32768) >> 16; }
+
+
+// En HSV y HSL las únicas divisiones son entre max - min, max o
+// (max + min): como todos son enteros en [0, 510] guardamos sus inversos
+// en coma fija y multiplicamos.
+// inverso16[d] = 2^16 / d, redondeado (inverso16[0] = 0)
+inline constexpr std::array<int, 511> inverso16 = []{
+    std::array<int, 511> t{};
+    for (int d = 1; d < 511; ++d)
+	t[d] = (65536 + d/2) / d;
+    return t;
+}();
+
+// Tono (en grados) de (r, g, b), con máximo mx y diferencia d = max - min.
+// Si d == 0 devuelve 0.
+inline int hue(int r, int g, int b, int mx, int d)
+{
+    bool es_r = (mx == r);
+    bool es_g = !es_r and (mx == g);
+
+    int num = es_r? g - b: (es_g? b - r: r - g);
+    int h   = (es_r? 0: (es_g? 120: 240)) + redondea16(60 * num * inverso16[d]);
+
+    return h + 360 * (h < 0) - 360 * (h >= 360);
+}
+}// namespace impl_of
+
+
+inline ColorHSV hsv(const ColorRGB& c)
+{
+    using namespace impl_of;
+    int r = a_8bits(c.r), g = a_8bits(c.g), b = a_8bits(c.b);
+
+    int mx = std::max({r, g, b});
+    int d  = mx - std::min({r, g, b});
+
+    // d == 0: inverso16[0] = 0 da (0, 0, mx)
+    return ColorHSV{hue(r, g, b, mx, d), redondea16(255 * d * inverso16[mx]),
+		    mx};
+}
+
+
+inline ColorHSL hsl(const ColorRGB& c)
+{
+    using namespace impl_of;
+    int r = a_8bits(c.r), g = a_8bits(c.g), b = a_8bits(c.b);
+
+    int mx = std::max({r, g, b});
+    int mn = std::min({r, g, b});
+    int d  = mx - mn;
+    int l2 = mx + mn;	// 2*l
+
+    // s = d / (1 - |2l - 1|)
+    int den = (l2 <= 255)? l2: 510 - l2;
+
+    return ColorHSL{hue(r, g, b, mx, d),
+		    a_8bits(redondea16(255 * d * inverso16[den])),
+		    (l2 + 1) / 2};
+}
+
+
+inline constexpr ColorYCbCr ycbcr(const ColorRGB& c,
+				  Norma_ycbcr n = Norma_ycbcr::bt601)
+{
+    using namespace impl_of;
+    const Coef_ycbcr& k = coef(n);
+
+    int r = a_8bits(c.r), g = a_8bits(c.g), b = a_8bits(c.b);
+
+    return ColorYCbCr{
+	    redondea16(k.yr * r + k.yg * g + k.yb * b),
+	    a_8bits(128 + redondea16(k.cbr * r + k.cbg * g + k.cbb * b)),
+	    a_8bits(128 + redondea16(k.crr * r + k.crg * g + k.crb * b))};
+}
+
+
+inline constexpr ColorRGB rgb(const ColorYCbCr& c,
+			      Norma_ycbcr n = Norma_ycbcr::bt601)
+{
+    using namespace impl_of;
+    const Coef_ycbcr& k = coef(n);
+
+    int cb = c.cb - 128;
+    int cr = c.cr - 128;
+
+    return ColorRGB{a_8bits(c.y + redondea16(k.r_cr * cr)),
+		    a_8bits(c.y + redondea16(k.g_cb * cb + k.g_cr * cr)),
+		    a_8bits(c.y + redondea16(k.b_cb * cb))};
+}
+
+
+
+/***************************************************************************
+ *			CONVERSIÓN DE TODA LA IMAGEN
+ ***************************************************************************/
+using ImageHSV   = alp::Matrix<ColorHSV, Ind>;
+using ImageHSL   = alp::Matrix<ColorHSL, Ind>;
+using ImageYCbCr = alp::Matrix<ColorYCbCr, Ind>;
+using ImageLab   = alp::Matrix<ColorLab, Ind>;
+
+
+/// Una imagen de 3 canales guardada en 3 planos.
+/// c0, c1 y c2 son las coordenadas en el orden en que se escriben
+/// (h, s, v; y, cb, cr; ...).
+struct Planos{
+    Plane<int> c0, c1, c2;
+};
+
+
+namespace impl_of{
+// ¿Podemos recorrer las filas de img0 con un puntero a ColorRGB?
+template <typename Img>
+inline constexpr bool filas_rgb_contiguas = 
+	es_uno_de<std::remove_const_t<Img>, Image, Subimage, const_Subimage>;
+}// namespace impl_of
+
+
+/// Aplica f a todos los pixeles de img0. Devuelve una matriz con el
+/// resultado.
+/// Img = Image, Subimage, o cualquier contenedor bidimensional.
+template <typename Img, typename F>
+auto convierte(const Img& img0, F f)
+{
+    using Res = decltype(f(img0(0, 0)));
+
+    Ind rows = img0.rows();
+    Ind cols = img0.cols();
+    alp::Matrix<Res, Ind> res{rows, cols};
+
+    if (cols == 0)
+	return res;
+
+    parallel_for(rows, [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i){
+	    Res* p = &res(i, 0);
+
+	    if constexpr (impl_of::filas_rgb_contiguas<Img>){
+		const ColorRGB* q = &img0(i, 0);
+		for (Ind j = 0; j < cols; ++j)
+		    p[j] = f(q[j]);
+	    }
+	    else
+		for (Ind j = 0; j < cols; ++j)
+		    p[j] = f(img0(i, j));
+	}
+    }, cols);
+
+    return res;
+}
+
+
+/// Igual que convierte, pero guardando el resultado en 3 planos.
+/// f tiene que devolver un struct de 3 coordenadas (ColorHSV, ...).
+template <typename Img, typename F>
+Planos convierte_a_planos(const Img& img0, F f)
+{
+    Ind rows = img0.rows();
+    Ind cols = img0.cols();
+    Planos res{Plane<int>{rows, cols}, Plane<int>{rows, cols},
+	       Plane<int>{rows, cols}};
+
+    if (cols == 0)
+	return res;
+
+    parallel_for(rows, [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i){
+	    int* p0 = &res.c0(i, 0);
+	    int* p1 = &res.c1(i, 0);
+	    int* p2 = &res.c2(i, 0);
+
+	    auto escribe = [&](Ind j, const auto& c){
+		auto [x0, x1, x2] = f(c);
+		p0[j] = x0;
+		p1[j] = x1;
+		p2[j] = x2;
+	    };
+
+	    if constexpr (impl_of::filas_rgb_contiguas<Img>){
+		const ColorRGB* q = &img0(i, 0);
+		for (Ind j = 0; j < cols; ++j)
+		    escribe(j, q[j]);
+	    }
+	    else
+		for (Ind j = 0; j < cols; ++j)
+		    escribe(j, img0(i, j));
+	}
+    }, cols);
+
+    return res;
+}
+
+
+// RGB -> otros
+// ------------
+template <typename Img>
+inline ImageHSV imagen_hsv(const Img& img0)
+{ return convierte(img0, [](const ColorRGB& c){return hsv(c);}); }
+
+template <typename Img>
+inline Planos planos_hsv(const Img& img0)
+{ return convierte_a_planos(img0, [](const ColorRGB& c){return hsv(c);}); }
+
+
+template <typename Img>
+inline ImageHSL imagen_hsl(const Img& img0)
+{ return convierte(img0, [](const ColorRGB& c){return hsl(c);}); }
+
+template <typename Img>
+inline Planos planos_hsl(const Img& img0)
+{ return convierte_a_planos(img0, [](const ColorRGB& c){return hsl(c);}); }
+
+
+template <typename Img>
+inline ImageYCbCr imagen_ycbcr(const Img& img0,
+			       Norma_ycbcr n = Norma_ycbcr::bt601)
+{ return convierte(img0, [n](const ColorRGB& c){return ycbcr(c, n);}); }
+
+template <typename Img>
+inline Planos planos_ycbcr(const Img& img0, Norma_ycbcr n = Norma_ycbcr::bt601)
+{
+    return convierte_a_planos(img0,
+			      [n](const ColorRGB& c){return ycbcr(c, n);});
+}
+
+
+template <typename Img>
+inline ImageLab imagen_lab(const Img& img0)
+{ return convierte(img0, [](const ColorRGB& c){return lab(c);}); }
+
+template <typename Img>
+inline Planos planos_lab(const Img& img0)
+{ return convierte_a_planos(img0, [](const ColorRGB& c){return lab(c);}); }
+
+
+// otros -> RGB
+// ------------
+/// Img = ImageHSV, ImageHSL o ImageLab (o una subimagen de ellas).
+template <typename Img>
+inline Image imagen_rgb(const Img& img0)
+{ return convierte(img0, [](const auto& c){return rgb(c);}); }
+
+/// Img = ImageYCbCr (o una subimagen).
+template <typename Img>
+inline Image imagen_rgb(const Img& img0, Norma_ycbcr n)
+{ return convierte(img0, [n](const ColorYCbCr& c){return rgb(c, n);}); }
+
+
+
+/***************************************************************************
+ *			    INTENSIDAD
+ ***************************************************************************/
+/// Pesos de r, g y b al calcular el gris.
+enum class Pesos_gris {
+    iguales,	// (r + g + b)/3, igual que intensidad(c)
+    bt601,	// luma: la y de YCbCr
+    bt709
+};
+
+
+namespace impl_of{
+// Gris de la fila [p, p + n) con pesos iguales. Dividimos entre 3
+// multiplicando: x / 3 == (x * 43691) >> 17 para todo 0 <= x < 2^17.
+template <typename T>
+void fila_gris_iguales(const ColorRGB* p, T* q, Ind n)
+{
+    for (Ind j = 0; j < n; ++j){
+	std::uint32_t s = a_8bits(p[j].r) + a_8bits(p[j].g) + a_8bits(p[j].b);
+
+	if constexpr (sizeof(T) == 1)
+	    q[j] = static_cast<T>((s * 43691u) >> 17);
+	else // s * 65535/765 = s * 257/3
+	    q[j] = static_cast<T>(85u * s + ((2u * s * 43691u) >> 17));
+    }
+}
+
+// Gris de la fila [p, p + n) con los pesos de y (en coma fija, suman 2^16),
+// redondeado.
+template <typename T>
+void fila_gris_luma(const ColorRGB* p, T* q, Ind n, const Coef_ycbcr& k)
+{
+    std::uint32_t kr = k.yr, kg = k.yg, kb = k.yb;
+
+    for (Ind j = 0; j < n; ++j){
+	std::uint32_t y = kr * a_8bits(p[j].r) + kg * a_8bits(p[j].g)
+						  + kb * a_8bits(p[j].b);
+	if constexpr (sizeof(T) == 1)
+	    q[j] = static_cast<T>((y + 32768u) >> 16);
+	else // 255 -> 65535 (no desborda: y*257 < 2^32)
+	    q[j] = static_cast<T>((y * 257u + 32768u) >> 16);
+    }
+}
+}// namespace impl_of
+
+
+/// Devuelve la imagen en grises como un plano contiguo de 8 bits
+/// (T = uint8_t, gris en [0, 255]) o de 16 bits (T = uint16_t, gris en
+/// [0, 65535]).
+/// Img = Image o Subimage (sus filas son contiguas en memoria).
+template <typename T = std::uint8_t, typename Img>
+Plane<T> plano_intensidad(const Img& img0, Pesos_gris pesos = Pesos_gris::iguales)
+{
+    static_assert(std::is_same_v<T, std::uint8_t> or
+		  std::is_same_v<T, std::uint16_t>,
+		  "plano_intensidad: solo 8 o 16 bits");
+
+    Ind rows = img0.rows();
+    Ind cols = img0.cols();
+    Plane<T> res{rows, cols};
+
+    if (rows == 0 or cols == 0)
+	return res;
+
+    parallel_for(rows, [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i){
+	    const ColorRGB* p = &img0(i, 0);
+	    T* q = &res(i, 0);
+
+	    if (pesos == Pesos_gris::iguales)
+		impl_of::fila_gris_iguales(p, q, cols);
+	    else
+		impl_of::fila_gris_luma(p, q, cols,
+				    impl_of::coef(pesos == Pesos_gris::bt601?
+						  Norma_ycbcr::bt601:
+						  Norma_ycbcr::bt709));
+	}
+    }, cols);
+
+    return res;
+}
+
+
+}// namespace img
+
+#endif
+
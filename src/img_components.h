@@ -0,0 +1,284 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#ifndef __IMG_COMPONENTS_H__
+#define __IMG_COMPONENTS_H__
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Componentes conexas de una imagen.
+ *
+ *   - COMENTARIOS: Dos pixeles vecinos pertenecen a la misma región si
+ *	cumplen un predicado (por defecto son_continuos). Una componente
+ *	conexa es el conjunto de pixeles que podemos alcanzar desde uno dado
+ *	moviéndonos de vecino en vecino.
+ *
+ *	    auto cc = componentes_conexas(img, Conectividad::ocho);
+ *	    cc.etiqueta(i, j);	    // componente a la que pertenece (i, j)
+ *	    cc.componentes[k].npixels; // número de pixeles de la componente k
+ *
+ *	Algoritmo: union-find en dos pasadas.
+ *	    1. Dividimos la imagen en bandas de filas y cada hilo etiqueta su
+ *	       banda, uniendo cada pixel con sus vecinos ya visitados.
+ *	    2. Unimos las componentes que cruzan de una banda a otra (solo
+ *	       hay que mirar la primera fila de cada banda).
+ *	    3. Cada pixel busca la raíz de su árbol y se numeran las raíces
+ *	       en el orden en que aparecen en la imagen (por filas).
+ *
+ *	La raíz de cada árbol es siempre el pixel de menor índice. Gracias a
+ *	esto la numeración no depende del número de hilos.
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include <vector>
+#include <algorithm>
+
+#include "img_image.h"
+#include "img_color.h"	    // son_continuos
+#include "img_parallel.h"
+
+namespace img{
+
+/// Vecinos que consideramos conectados a un pixel.
+enum class Conectividad {
+    cuatro, // N, S, E, W
+    ocho    // N, S, E, W, NE, NW, SE, SW
+};
+
+
+/// Información de una componente conexa.
+struct Componente{
+    Ind npixels;    // número de pixeles
+    Position p0;    // esquina superior izquierda del rectángulo que la contiene
+    Position pe;    // esquina inferior derecha (incluida)
+};
+
+
+/// Resultado de etiquetar una imagen.
+struct Componentes_conexas{
+    /// etiqueta(i, j) = número de la componente a la que pertenece el
+    /// pixel (i, j). Las componentes se numeran 0, 1, 2... por orden de
+    /// aparición recorriendo la imagen por filas.
+    Plane<int> etiqueta;
+
+    /// componentes[k] = información de la componente k.
+    std::vector<Componente> componentes;
+
+    /// Número de componentes
+    int size() const {return static_cast<int>(componentes.size());}
+};
+
+
+/// Predicado por defecto para decidir si dos pixeles vecinos pertenecen a
+/// la misma región.
+struct Son_continuos{
+    bool operator()(const ColorRGB& a, const ColorRGB& b) const
+    { return son_continuos(a, b); }
+};
+
+
+namespace impl_of{
+// Union-find sobre los índices de los pixeles (n = i*cols + j).
+// Unimos siempre hacia el índice menor: la raíz es el mínimo del árbol.
+class Union_find{
+public:
+    explicit Union_find(int n) : padre_(n) {}
+
+    void inicializa(int n0, int ne)
+    {
+	for (int n = n0; n < ne; ++n)
+	    padre_[n] = n;
+    }
+
+    // Con compresión de caminos (path halving): modifica padre_.
+    int raiz(int n)
+    {
+	while (padre_[n] != n){
+	    padre_[n] = padre_[padre_[n]];
+	    n = padre_[n];
+	}
+	return n;
+    }
+
+    // Sin modificar nada: se puede llamar desde varios hilos a la vez.
+    int raiz_const(int n) const
+    {
+	while (padre_[n] != n)
+	    n = padre_[n];
+	return n;
+    }
+
+    void une(int a, int b)
+    {
+	a = raiz(a);
+	b = raiz(b);
+
+	if (a < b)	padre_[b] = a;
+	else if (b < a) padre_[a] = b;
+    }
+
+private:
+    std::vector<int> padre_;
+};
+
+
+// Une el pixel (i, j) con sus vecinos de la fila anterior (i - 1).
+template <typename Img, typename Pred>
+inline void une_con_fila_anterior(const Img& img0, Union_find& uf,
+				  Ind i, Ind j, Conectividad con, Pred& pred)
+{
+    Ind cols = img0.cols();
+    int n = i*cols + j;
+    const auto& x = img0(i, j);
+
+    if (pred(x, img0(i - 1, j)))
+	uf.une(n, n - cols);
+
+    if (con == Conectividad::ocho){
+	if (j > 0 and pred(x, img0(i - 1, j - 1)))
+	    uf.une(n, n - cols - 1);
+
+	if (j + 1 < cols and pred(x, img0(i - 1, j + 1)))
+	    uf.une(n, n - cols + 1);
+    }
+}
+
+}// namespace impl_of
+
+
+/// Etiqueta las componentes conexas de img0.
+///
+/// Img : Image, Subimage, o cualquier contenedor bidimensional.
+/// Pred: pred(a, b) == true si los pixeles vecinos a y b pertenecen a la
+///	  misma región. Tiene que ser simétrico.
+///
+/// Precondición: img0.rows()*img0.cols() cabe en un int.
+template <typename Img, typename Pred = Son_continuos>
+Componentes_conexas componentes_conexas(const Img& img0,
+				Conectividad con = Conectividad::cuatro,
+				Pred pred = Pred{})
+{
+    Ind rows = img0.rows();
+    Ind cols = img0.cols();
+
+    Componentes_conexas res{Plane<int>{rows, cols}, {}};
+    if (rows == 0 or cols == 0)
+	return res;
+
+    impl_of::Union_find uf{rows * cols};
+    std::vector<char> inicio_banda(rows, 0);
+
+    // 1. Cada banda por separado
+    parallel_for(rows, [&](Ind i0, Ind ie){
+	Pred pred_banda = pred;	// cada hilo su copia
+	inicio_banda[i0] = 1;
+	uf.inicializa(i0*cols, ie*cols);
+
+	for (Ind i = i0; i < ie; ++i){
+	    int n = i*cols;
+
+	    for (Ind j = 0; j < cols; ++j, ++n){
+		if (j > 0 and pred_banda(img0(i, j), img0(i, j - 1)))
+		    uf.une(n, n - 1);
+
+		if (i > i0)
+		    impl_of::une_con_fila_anterior(img0, uf, i, j, con,
+								    pred_banda);
+	    }
+	}
+    }, cols);
+
+    // 2. Unimos las bandas
+    for (Ind i = 1; i < rows; ++i){
+	if (inicio_banda[i])
+	    for (Ind j = 0; j < cols; ++j)
+		impl_of::une_con_fila_anterior(img0, uf, i, j, con, pred);
+    }
+
+    // 3. Buscamos las raíces y las numeramos por filas
+    Plane<int>& et = res.etiqueta;
+    std::vector<int> nraices(rows, 0); // número de raíces en cada fila
+
+    parallel_for(rows, [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i){
+	    int* p = &et(i, 0);
+	    int n = i*cols;
+	    int nr = 0;
+	    for (Ind j = 0; j < cols; ++j, ++n){
+		p[j] = uf.raiz_const(n);
+		if (p[j] == n) ++nr;
+	    }
+	    nraices[i] = nr;
+	}
+    }, cols);
+
+    // nraices[i] = número de la primera raíz de la fila i
+    int total = 0;
+    for (Ind i = 0; i < rows; ++i){
+	int nr = nraices[i];
+	nraices[i] = total;
+	total += nr;
+    }
+
+    // numero[raiz] = número de la componente
+    std::vector<int> numero(rows * cols);
+    parallel_for(rows, [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i){
+	    const int* p = &et(i, 0);
+	    int n = i*cols;
+	    int k = nraices[i];
+	    for (Ind j = 0; j < cols; ++j, ++n)
+		if (p[j] == n) numero[n] = k++;
+	}
+    }, cols);
+
+    parallel_for(rows, [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i){
+	    int* p = &et(i, 0);
+	    for (Ind j = 0; j < cols; ++j)
+		p[j] = numero[p[j]];
+	}
+    }, cols);
+
+    // 4. Estadísticas de cada componente
+    res.componentes.assign(total, Componente{0, Position{rows, cols},
+						Position{-1, -1}});
+    for (Ind i = 0; i < rows; ++i){
+	const int* p = &et(i, 0);
+	for (Ind j = 0; j < cols; ++j){
+	    Componente& c = res.componentes[p[j]];
+	    ++c.npixels;
+	    c.p0.i = std::min(c.p0.i, i);
+	    c.p0.j = std::min(c.p0.j, j);
+	    c.pe.i = std::max(c.pe.i, i);
+	    c.pe.j = std::max(c.pe.j, j);
+	}
+    }
+
+    return res;
+}
+
+
+}// namespace img
+
+#endif
+
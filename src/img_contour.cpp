@@ -0,0 +1,161 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "img_contour.h"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace img{
+
+// Desplazamiento (i, j) de cada dirección, en el orden de Direccion:
+//		     E  NE   N  NW   W  SW   S  SE
+static constexpr int di[8] = { 0, -1, -1, -1,  0,  1,  1,  1};
+static constexpr int dj[8] = { 1,  1,  0, -1, -1, -1,  0,  1};
+
+// Si hemos llegado al pixel actual moviéndonos en la dirección d, el
+// siguiente pixel del contorno lo empezamos a buscar en la dirección
+// inicio_busqueda[d], girando en sentido positivo:
+//	d par  : d + 7 (= d - 45º)
+//	d impar: d + 6 (= d - 90º)
+static constexpr int inicio_busqueda[8] = {7, 7, 1, 1, 3, 3, 5, 5};
+
+
+// Copia de las etiquetas con un borde de un pixel de fondo (-1).
+class Plano_con_borde{
+public:
+    explicit Plano_con_borde(const Plane<int>& et)
+	: cols_{et.cols() + 2}, 
+	  v_(static_cast<size_t>(et.rows() + 2) * cols_, -1)
+    {
+	for (Ind i = 0; i < et.rows(); ++i)
+	    std::copy(&et(i, 0), &et(i, 0) + et.cols(), ptr(Position{i, 0}));
+
+	for (int k = 0; k < 8; ++k)
+	    desplazamiento_[k] = di[k] * static_cast<std::ptrdiff_t>(cols_)
+							    + dj[k];
+    }
+
+    // Puntero al pixel p (en coordenadas de la imagen original)
+    const int* ptr(const Position& p) const
+    { return v_.data() + static_cast<size_t>(p.i + 1) * cols_ + (p.j + 1); }
+
+    int* ptr(const Position& p)
+    { return v_.data() + static_cast<size_t>(p.i + 1) * cols_ + (p.j + 1); }
+
+    std::ptrdiff_t desplazamiento(int d) const {return desplazamiento_[d];}
+
+private:
+    Ind cols_;
+    std::vector<int> v_;
+    std::ptrdiff_t desplazamiento_[8];
+};
+
+
+// Precondición: s es el primer pixel, por filas, de su región.
+static Contorno traza(const Plano_con_borde& P, const Position& s)
+{
+    const int* ps = P.ptr(s);
+    int L = *ps;
+
+    Contorno c{L, s, {}};
+
+    const int* p = ps;
+    int d = 7;		// como si hubiéramos llegado desde el NW
+    int primera = -1;	// dirección del primer paso
+
+    while (true){
+	int k = inicio_busqueda[d];
+	int n = 0;
+	for (; n < 8; ++n, k = (k + 1) & 7)
+	    if (p[P.desplazamiento(k)] == L)
+		break;
+
+	if (n == 8)	// pixel aislado
+	    return c;
+
+	if (p == ps and k == primera) // hemos dado la vuelta
+	    return c;
+
+	if (primera == -1)
+	    primera = k;
+
+	c.cadena.push_back(static_cast<std::uint8_t>(k));
+	p += P.desplazamiento(k);
+	d = k;
+    }
+}
+
+
+Contorno contorno(const Plane<int>& etiqueta, Position inicio)
+{
+    Plano_con_borde P{etiqueta};
+    return traza(P, inicio);
+}
+
+
+std::vector<Contorno> contornos(const Plane<int>& etiqueta)
+{
+    std::vector<Contorno> res;
+
+    if (etiqueta.rows() == 0 or etiqueta.cols() == 0)
+	return res;
+
+    Plano_con_borde P{etiqueta};
+
+    int max = *std::max_element(etiqueta.begin(), etiqueta.end());
+    std::vector<char> visto(max < 0? 0: max + 1, 0);
+
+    for (Ind i = 0; i < etiqueta.rows(); ++i){
+	const int* p = &etiqueta(i, 0);
+
+	for (Ind j = 0; j < etiqueta.cols(); ++j){
+	    int L = p[j];
+	    if (L >= 0 and !visto[L]){
+		visto[L] = 1;
+		res.push_back(traza(P, Position{i, j}));
+	    }
+	}
+    }
+
+    return res;
+}
+
+
+std::vector<Position> puntos(const Contorno& c)
+{
+    std::vector<Position> res;
+    res.reserve(c.size());
+
+    Position p = c.inicio;
+    res.push_back(p);
+
+    // el último paso vuelve al inicio: no lo añadimos
+    for (size_t k = 0; k + 1 < c.cadena.size(); ++k){
+	int d = c.cadena[k];
+	p.i += di[d];
+	p.j += dj[d];
+	res.push_back(p);
+    }
+
+    return res;
+}
+
+
+}// namespace img
+
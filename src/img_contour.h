@@ -0,0 +1,97 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#ifndef __IMG_CONTOUR_H__
+#define __IMG_CONTOUR_H__
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Contornos de las regiones de una imagen de etiquetas
+ *	(algoritmo de la muralla).
+ *
+ *   - COMENTARIOS: Para obtener el contorno de una región nos colocamos
+ *	en su primer pixel y vamos siguiendo la muralla, girando a la
+ *	derecha o a la izquierda según encontremos pixeles de la región o
+ *	no, hasta volver al punto de partida.
+ *
+ *	El contorno se guarda como un código de cadena: el punto de partida y
+ *	la lista de direcciones (Direccion) en que nos movemos.
+ *
+ *	    auto cc = componentes_conexas(img);
+ *	    auto cs = contornos(cc.etiqueta);	// uno por región
+ *	    auto ps = puntos(cs[3]);		// puntos del contorno 3
+ *
+ *	Para que sea rápido:
+ *	    + Copiamos las etiquetas a un plano con un borde de un pixel, de
+ *	      esa forma al mirar los vecinos nunca nos salimos de la imagen.
+ *	    + Los vecinos se miran sumando al puntero del pixel actual un
+ *	      desplazamiento precalculado para cada una de las 8 direcciones.
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include <vector>
+#include <cstdint>
+
+#include "img_image.h"
+#include "img_iterator2D.h"	// Direccion
+
+namespace img{
+
+/// Contorno exterior de una región, como código de cadena.
+/// Recorre la región dejándola a la izquierda (sentido positivo).
+struct Contorno{
+    int etiqueta;		    // etiqueta de la región
+    Position inicio;		    // primer pixel (por filas) de la región
+    std::vector<std::uint8_t> cadena; // direcciones en que nos movemos
+				      // (static_cast<int>(Direccion))
+
+    /// Número de puntos distintos de la cadena (el último paso vuelve a
+    /// inicio).
+    size_t size() const {return cadena.empty()? 1: cadena.size();}
+
+    /// Dirección del paso k
+    Direccion direccion(size_t k) const
+    { return static_cast<Direccion>(cadena[k]); }
+};
+
+
+/// Traza el contorno exterior de la región a la que pertenece inicio.
+/// Precondición: inicio es el primer pixel de su región recorriendo
+/// la imagen por filas.
+Contorno contorno(const Plane<int>& etiqueta, Position inicio);
+
+/// Traza los contornos exteriores de todas las regiones de la imagen de
+/// etiquetas (las etiquetas negativas se consideran fondo y se ignoran).
+/// Devuelve los contornos ordenados por el orden de aparición de la
+/// región recorriendo la imagen por filas. Si las etiquetas son las de
+/// componentes_conexas, contornos(et)[k] es el contorno de la región k.
+std::vector<Contorno> contornos(const Plane<int>& etiqueta);
+
+/// Convierte el código de cadena en la lista de puntos del contorno
+/// (sin repetir el punto inicial al final).
+std::vector<Position> puntos(const Contorno& c);
+
+
+}// namespace img
+
+#endif
+
@@ -34,6 +34,8 @@
 #define cimg_display 0
 
 #include <string>
+#include <algorithm>
+#include <limits>
 #include <filesystem>
 
 
@@ -121,7 +123,24 @@ Image read(const std::string& name)
 }
 
 
-void write(const Image& img, const std::string& name)
+// El canal x ya en [0, 255]
+struct Canal_exacto{
+    unsigned char operator()(int x) const
+    { return alp::narrow_cast<unsigned char>(x); }
+};
+
+// Recorta x al rango de Color ([0, 255])
+struct Canal_saturado{
+    unsigned char operator()(int x) const
+    {
+	return static_cast<unsigned char>(
+		    std::clamp<int>(x, std::numeric_limits<Color>::min(),
+				       std::numeric_limits<Color>::max()));
+    }
+};
+
+template <typename Canal>
+static void write_(const Image& img, const std::string& name, Canal canal)
 {
     // Todas las imagenes que uso son RGB, 3 canales!
     cimg::CImg<unsigned char> m{alp::narrow_cast<unsigned int>(img.cols())
@@ -132,9 +151,9 @@ void write(const Image& img, const std::string& name)
     for(int y=0 ; y != m.height(); ++y)
 	for(int x = 0; x != m.width(); ++x)
     {
-	*m.data(x,y,0,0) = alp::narrow_cast<unsigned char>((*p).r);
-	*m.data(x,y,0,1) = alp::narrow_cast<unsigned char>((*p).g);
-	*m.data(x,y,0,2) = alp::narrow_cast<unsigned char>((*p).b);
+	*m.data(x,y,0,0) = canal((*p).r);
+	*m.data(x,y,0,1) = canal((*p).g);
+	*m.data(x,y,0,2) = canal((*p).b);
 
 	++p;
     }
@@ -142,5 +161,18 @@ void write(const Image& img, const std::string& name)
     m.save(name.c_str());
 }
 
+
+void write(const Image& img, const std::string& name)
+{ write_(img, name, Canal_exacto{}); }
+
+
+void write(const Image& img, const std::string& name, Fuera_de_rango modo)
+{
+    if (modo == Fuera_de_rango::satura)
+	write_(img, name, Canal_saturado{});
+    else
+	write_(img, name, Canal_exacto{});
+}
+
 }
 
@@ -0,0 +1,291 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#ifndef __IMG_DIFF_H__
+#define __IMG_DIFF_H__
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Diferencias entre dos imágenes, con tolerancia.
+ *
+ *   - COMENTARIOS: Dos pixeles son iguales si lo son según
+ *	alp::Aproximado<ColorRGB>{tolerancia}: ninguno de sus canales se
+ *	diferencia en más de tolerancia.
+ *
+ *	    Diferencias d = compara(img0, img1, 2);
+ *	    if (!d.iguales())
+ *		std::cout << d.n << " pixeles distintos en "
+ *			  << d.zona.i0 << ", " << d.zona.j0 << '\n';
+ *
+ *	    if (hay_diferencias(img0, img1)) ...    // termina en cuanto
+ *						    // encuentra una
+ *
+ *	Las imágenes se recorren por filas, repartidas entre los hilos. El
+ *	bucle que recorre cada fila no tiene ningún if: acumula los errores y
+ *	cuenta los pixeles distintos (el compilador lo puede vectorizar).
+ *	Solo en las filas en las que hay diferencias se vuelve a recorrer
+ *	la fila para calcular la zona y la máscara.
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+
+#include "img_image.h"
+#include "img_color.h"
+#include "img_draw.h"	// Ventana
+#include "img_parallel.h"
+
+namespace img{
+
+/// Resultado de comparar dos imágenes.
+struct Diferencias{
+    std::size_t n = 0;	    // número de pixeles distintos
+
+    // Errores (valor absoluto de la diferencia) de cada canal, calculados
+    // con todos los pixeles (también los que se consideran iguales).
+    ColorRGB error_max{0, 0, 0};
+    double error_medio_r = 0;
+    double error_medio_g = 0;
+    double error_medio_b = 0;
+
+    /// Menor rectángulo que contiene a todos los pixeles distintos (vacío
+    /// si son iguales).
+    Ventana zona{0, 0, 0, 0};
+
+    bool iguales() const {return n == 0;}
+};
+
+
+namespace impl_of{
+// Acumulados de una banda de filas
+struct Diferencias_banda{
+    std::size_t n = 0;
+    ColorRGB error_max{0, 0, 0};
+    std::uint64_t suma_r = 0, suma_g = 0, suma_b = 0;
+    Ventana zona{0, 0, 0, 0};   // vacía si n == 0
+
+    void une(const Diferencias_banda& x);
+};
+
+inline void Diferencias_banda::une(const Diferencias_banda& x)
+{
+    if (x.n != 0){
+	if (n == 0)
+	    zona = x.zona;
+	else
+	    zona = Ventana{std::min(zona.i0, x.zona.i0),
+			   std::max(zona.ie, x.zona.ie),
+			   std::min(zona.j0, x.zona.j0),
+			   std::max(zona.je, x.zona.je)};
+    }
+
+    n += x.n;
+    error_max = ColorRGB{std::max(error_max.r, x.error_max.r),
+			 std::max(error_max.g, x.error_max.g),
+			 std::max(error_max.b, x.error_max.b)};
+    suma_r += x.suma_r;
+    suma_g += x.suma_g;
+    suma_b += x.suma_b;
+}
+
+
+// Compara las filas a y b de n pixeles. Devuelve el número de pixeles
+// distintos y acumula los errores.
+inline Ind compara_fila(const ColorRGB* a, const ColorRGB* b, Ind n, int tol,
+			Diferencias_banda& res)
+{
+    int max_r = res.error_max.r, max_g = res.error_max.g,
+					   max_b = res.error_max.b;
+    std::uint32_t suma_r = 0, suma_g = 0, suma_b = 0;	// < 2^31 / 255
+    Ind distintos = 0;
+
+    for (Ind j = 0; j < n; ++j){
+	int dr = std::abs(a[j].r - b[j].r);
+	int dg = std::abs(a[j].g - b[j].g);
+	int db = std::abs(a[j].b - b[j].b);
+
+	max_r = std::max(max_r, dr);
+	max_g = std::max(max_g, dg);
+	max_b = std::max(max_b, db);
+
+	suma_r += dr;
+	suma_g += dg;
+	suma_b += db;
+
+	distintos += (std::max({dr, dg, db}) > tol);
+    }
+
+    res.error_max = ColorRGB{max_r, max_g, max_b};
+    res.suma_r += suma_r;
+    res.suma_g += suma_g;
+    res.suma_b += suma_b;
+
+    return distintos;
+}
+
+inline bool distintos(const ColorRGB& a, const ColorRGB& b, int tol)
+{ return !alp::Aproximado<ColorRGB>{tol}(a, b); }
+
+
+template <typename Img1, typename Img2>
+void comprueba_tamanos(const Img1& a, const Img2& b)
+{
+    if (a.rows() != b.rows() or a.cols() != b.cols())
+	throw std::logic_error{"compara: las imágenes tienen distinto tamaño"};
+}
+
+
+// Si mascara != nullptr escribe en ella 255 en los pixeles distintos y 0 en
+// los iguales.
+template <typename Img1, typename Img2>
+Diferencias compara(const Img1& a, const Img2& b, int tol,
+		    Plane<std::uint8_t>* mascara)
+{
+    comprueba_tamanos(a, b);
+
+    Ind rows = a.rows();
+    Ind cols = a.cols();
+
+    Diferencias_banda total;
+    std::mutex m;
+
+    if (mascara)
+	*mascara = Plane<std::uint8_t>{rows, cols};
+
+    parallel_for((cols > 0? rows: 0), [&](Ind i0, Ind ie){
+	Diferencias_banda res;
+
+	for (Ind i = i0; i < ie; ++i){
+	    const ColorRGB* p = &a(i, 0);
+	    const ColorRGB* q = &b(i, 0);
+
+	    Ind n = compara_fila(p, q, cols, tol, res);
+
+	    std::uint8_t* r = (mascara? &(*mascara)(i, 0): nullptr);
+	    if (n == 0){
+		if (r)
+		    std::fill(r, r + cols, std::uint8_t{0});
+		continue;
+	    }
+
+	    // Esta fila tiene diferencias
+	    Ind j0 = 0;
+	    while (!distintos(p[j0], q[j0], tol))
+		++j0;
+
+	    Ind je = cols;
+	    while (!distintos(p[je - 1], q[je - 1], tol))
+		--je;
+
+	    Diferencias_banda fila;
+	    fila.n = n;
+	    fila.zona = Ventana{i, i + 1, j0, je};
+	    res.une(fila);
+
+	    if (r)
+		for (Ind j = 0; j < cols; ++j)
+		    r[j] = distintos(p[j], q[j], tol)? 255: 0;
+	}
+
+	std::lock_guard<std::mutex> lock{m};
+	total.une(res);
+    }, 2 * cols);
+
+    Diferencias res;
+    res.n = total.n;
+    res.error_max = total.error_max;
+    res.zona = total.zona;
+
+    double npixels = static_cast<double>(rows) * cols;
+    if (npixels > 0){
+	res.error_medio_r = total.suma_r / npixels;
+	res.error_medio_g = total.suma_g / npixels;
+	res.error_medio_b = total.suma_b / npixels;
+    }
+
+    return res;
+}
+}// namespace impl_of
+
+
+
+/****************************************************************************
+ *
+ *   - FUNCIÓN: compara
+ *
+ *   - DESCRIPCIÓN: Compara las imágenes a y b, considerando iguales los
+ *	pixeles que se diferencian como mucho en tolerancia en cada canal.
+ *
+ *	Img1, Img2 = Image o Subimage (sus filas son contiguas en memoria).
+ *
+ *	Si se pasa mascara, escribe en ella 255 en los pixeles distintos y 0
+ *	en los iguales.
+ *
+ *   - PRECONDICIÓN: a y b tienen el mismo tamaño (si no, lanza
+ *	std::logic_error).
+ *
+ ****************************************************************************/
+template <typename Img1, typename Img2>
+inline Diferencias compara(const Img1& a, const Img2& b, int tolerancia = 0)
+{ return impl_of::compara(a, b, tolerancia, nullptr); }
+
+template <typename Img1, typename Img2>
+inline Diferencias compara(const Img1& a, const Img2& b, int tolerancia,
+			   Plane<std::uint8_t>& mascara)
+{ return impl_of::compara(a, b, tolerancia, &mascara); }
+
+
+/// ¿Hay algún pixel distinto (con la tolerancia dada)? Los hilos dejan de
+/// buscar en cuanto alguno encuentra una diferencia.
+template <typename Img1, typename Img2>
+bool hay_diferencias(const Img1& a, const Img2& b, int tolerancia = 0)
+{
+    impl_of::comprueba_tamanos(a, b);
+
+    Ind cols = a.cols();
+    if (cols == 0)
+	return false;
+
+    std::atomic<bool> encontrada{false};
+
+    parallel_for(a.rows(), [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie and !encontrada.load(std::memory_order_relaxed);
+									++i){
+	    impl_of::Diferencias_banda res;
+	    if (impl_of::compara_fila(&a(i, 0), &b(i, 0), cols, tolerancia, res))
+		encontrada = true;
+	}
+    }, 2 * cols);
+
+    return encontrada;
+}
+
+
+}// namespace img
+
+#endif
+
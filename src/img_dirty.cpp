@@ -0,0 +1,172 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "img_dirty.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace img{
+
+namespace {
+// Se llama en la lista de inicialización: hay que validar lado antes de
+// dividir por él.
+Ind lado_valido(Ind lado)
+{
+    if (lado <= 0)
+	throw std::logic_error{"Registro_cambios: el lado de la tesela "
+			       "tiene que ser positivo"};
+    return lado;
+}
+}// namespace
+
+Registro_cambios::Registro_cambios(Ind rows, Ind cols, Ind lado)
+    : rows_{rows}, cols_{cols}, lado_{lado_valido(lado)},
+      nti_{(rows + lado_ - 1) / lado_},
+      ntj_{(cols + lado_ - 1) / lado_},
+      sucia_(static_cast<size_t>(nti_) * ntj_, 0),
+      n_{0}
+{ }
+
+
+void Registro_cambios::limpia()
+{
+    std::fill(sucia_.begin(), sucia_.end(), 0);
+    n_ = 0;
+}
+
+
+void Registro_cambios::marca(Ind i, Ind j0, Ind je)
+{
+    j0 = std::max(j0, Ind{0});
+    je = std::min(je, cols_);
+
+    if (i < 0 or i >= rows_ or j0 >= je)
+	return;
+
+    Ind ti = i / lado_;
+    for (Ind tj = j0 / lado_; tj <= (je - 1) / lado_; ++tj)
+	marca_tesela(ti, tj);
+}
+
+
+void Registro_cambios::marca(const Ventana& w)
+{
+    Ind i0 = std::max(w.i0, Ind{0});
+    Ind ie = std::min(w.ie, rows_);
+    Ind j0 = std::max(w.j0, Ind{0});
+    Ind je = std::min(w.je, cols_);
+
+    if (i0 >= ie or j0 >= je)
+	return;
+
+    for (Ind ti = i0 / lado_; ti <= (ie - 1) / lado_; ++ti)
+	for (Ind tj = j0 / lado_; tj <= (je - 1) / lado_; ++tj)
+	    marca_tesela(ti, tj);
+}
+
+
+void Registro_cambios::marca(const Rectangulo& r)
+{
+    Position p0 = r.upper_left_corner();
+    Position pe = r.bottom_right_corner();
+
+    marca(Ventana{std::min(p0.i, pe.i), std::max(p0.i, pe.i) + 1,
+		  std::min(p0.j, pe.j), std::max(p0.j, pe.j) + 1});
+}
+
+
+Ventana Registro_cambios::tesela(Ind ti, Ind tj) const
+{
+    return Ventana{ti * lado_, std::min((ti + 1) * lado_, rows_),
+		   tj * lado_, std::min((tj + 1) * lado_, cols_)};
+}
+
+
+std::vector<Ventana> Registro_cambios::zonas() const
+{
+    // Trabajamos en coordenadas de teselas. 'abiertas' son los rectángulos
+    // que llegan hasta la fila anterior y todavía pueden crecer.
+    std::vector<Ventana> res;
+    std::vector<Ventana> abiertas, siguientes;
+
+    auto cierra = [&](const Ventana& t){
+	Ventana a = tesela(t.i0, t.j0);
+	Ventana b = tesela(t.ie - 1, t.je - 1);
+	res.push_back(Ventana{a.i0, b.ie, a.j0, b.je});
+    };
+
+    for (Ind ti = 0; ti < nti_; ++ti){
+	siguientes.clear();
+
+	Ind tj = 0;
+	while (tj < ntj_){
+	    if (!modificada(ti, tj)){
+		++tj;
+		continue;
+	    }
+
+	    Ind tj0 = tj;
+	    while (tj < ntj_ and modificada(ti, tj))
+		++tj;
+
+	    // ¿Continúa uno de la fila anterior?
+	    auto p = std::find_if(abiertas.begin(), abiertas.end(),
+		    [&](const Ventana& t){return t.j0 == tj0 and t.je == tj;});
+
+	    if (p != abiertas.end()){
+		siguientes.push_back(Ventana{p->i0, ti + 1, tj0, tj});
+		abiertas.erase(p);
+	    }
+	    else
+		siguientes.push_back(Ventana{ti, ti + 1, tj0, tj});
+	}
+
+	for (const Ventana& t: abiertas)
+	    cierra(t);
+
+	std::swap(abiertas, siguientes);
+    }
+
+    for (const Ventana& t: abiertas)
+	cierra(t);
+
+    return res;
+}
+
+
+Ventana Registro_cambios::zona_total() const
+{
+    Ventana res{rows_, 0, cols_, 0};
+
+    for (Ind ti = 0; ti < nti_; ++ti)
+	for (Ind tj = 0; tj < ntj_; ++tj)
+	    if (modificada(ti, tj)){
+		Ventana t = tesela(ti, tj);
+		res.i0 = std::min(res.i0, t.i0);
+		res.ie = std::max(res.ie, t.ie);
+		res.j0 = std::min(res.j0, t.j0);
+		res.je = std::max(res.je, t.je);
+	    }
+
+    return res;
+}
+
+
+}// namespace img
+
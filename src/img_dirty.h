@@ -0,0 +1,296 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#ifndef __IMG_DIRTY_H__
+#define __IMG_DIRTY_H__
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Registro de las zonas de una imagen que se han
+ *	modificado.
+ *
+ *   - COMENTARIOS: Si después de unos pocos draw hay que volver a
+ *	escribir o mostrar la imagen, basta con procesar lo que ha cambiado.
+ *	El registro es opcional: solo se actualiza si se dibuja a través de
+ *	él.
+ *
+ *	    Registro_cambios reg{img.rows(), img.cols()};
+ *	    draw(img, reg, s, ColorRGB::rojo());
+ *	    draw_circulo(img, reg, c, ColorRGB::verde());
+ *
+ *	    for (const Ventana& w: reg.zonas())
+ *		muestra(img, w);	// solo lo que ha cambiado
+ *	    reg.limpia();
+ *
+ *	La imagen se divide en teselas (por defecto de 64 x 64) y se
+ *	recuerda qué teselas se han modificado. De esta forma el registro
+ *	ocupa siempre lo mismo, da igual cuántas veces se dibuje, y zonas()
+ *	devuelve como mucho tantos rectángulos como teselas hay.
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include <vector>
+#include <span>
+
+#include "img_image.h"
+#include "img_view.h"	// Subimage
+#include "img_draw.h"
+
+namespace img{
+
+/*!
+ *  \brief  Teselas de una imagen que se han modificado.
+ *
+ */
+class Registro_cambios{
+public:
+    /// Registro de una imagen de rows x cols dividida en teselas de
+    /// lado x lado pixeles.
+    Registro_cambios(Ind rows, Ind cols, Ind lado = 64);
+
+    Ind rows() const {return rows_;}
+    Ind cols() const {return cols_;}
+    Ind lado_tesela() const {return lado_;}
+
+    /// Número de teselas en cada dirección.
+    Ind rows_teselas() const {return nti_;}
+    Ind cols_teselas() const {return ntj_;}
+
+
+    // Marcar
+    // ------
+    /// Se ha modificado el pixel (i, j). Si está fuera de la imagen no
+    /// marca nada.
+    void marca(Ind i, Ind j)
+    {
+	if (0 <= i and i < rows_ and 0 <= j and j < cols_)
+	    marca_tesela(i / lado_, j / lado_);
+    }
+
+    /// Se han modificado los pixeles [j0, je) de la fila i (se recorta a
+    /// la imagen).
+    void marca(Ind i, Ind j0, Ind je);
+
+    /// Se han modificado los pixeles de la ventana w (se recorta a la
+    /// imagen).
+    void marca(const Ventana& w);
+
+    /// Se ha modificado el rectángulo r (incluidos sus bordes).
+    void marca(const Rectangulo& r);
+
+
+    // Consultar
+    // ---------
+    /// ¿Ha cambiado algo?
+    bool hay_cambios() const {return n_ != 0;}
+
+    /// ¿Se ha modificado la tesela (ti, tj)?
+    bool modificada(Ind ti, Ind tj) const
+    { return sucia_[ti * ntj_ + tj] != 0; }
+
+    /// Número de teselas modificadas.
+    int num_teselas() const {return n_;}
+
+    /// Pixeles que cubre la tesela (ti, tj) (recortada a la imagen).
+    Ventana tesela(Ind ti, Ind tj) const;
+
+    /// Rectángulos que cubren todas las teselas modificadas. Las teselas
+    /// contiguas se unen en un único rectángulo: primero por filas y luego
+    /// los tramos iguales de filas consecutivas.
+    std::vector<Ventana> zonas() const;
+
+    /// Menor rectángulo que contiene a todas las teselas modificadas
+    /// (vacío si no hay cambios).
+    Ventana zona_total() const;
+
+
+    /// Olvida todos los cambios.
+    void limpia();
+
+private:
+    Ind rows_, cols_;
+    Ind lado_;
+    Ind nti_, ntj_;
+    std::vector<char> sucia_;	// sucia_[ti * ntj_ + tj]
+    int n_;			// número de teselas sucias
+
+    void marca_tesela(Ind ti, Ind tj)
+    {
+	char& s = sucia_[ti * ntj_ + tj];
+	if (!s){
+	    s = 1;
+	    ++n_;
+	}
+    }
+};
+
+
+/// Pincel que dibuja con otro pincel y apunta en un registro los pixeles
+/// que pinta.
+template <typename Pincel>
+class Pincel_registro{
+public:
+    Pincel_registro(Pincel& pincel, Registro_cambios& reg)
+	: pincel_{pincel}, reg_{reg} {}
+
+    void punto(Ind i, Ind j)
+    {
+	pincel_.punto(i, j);
+	reg_.marca(i, j);
+    }
+
+    void punto(Ind i, Ind j, int alfa)
+    {
+	pincel_.punto(i, j, alfa);
+	reg_.marca(i, j);
+    }
+
+    void tramo_h(Ind i, Ind j0, Ind je)
+    {
+	pincel_.tramo_h(i, j0, je);
+	reg_.marca(i, j0, je);
+    }
+
+    void tramo_v(Ind j, Ind i0, Ind ie)
+    {
+	pincel_.tramo_v(j, i0, ie);
+	reg_.marca(Ventana{i0, ie, j, j + 1});
+    }
+
+private:
+    Pincel& pincel_;
+    Registro_cambios& reg_;
+};
+
+
+/// Subimagen de img0 que vamos a modificar: se marca entera en el
+/// registro.
+inline Subimage subimagen_modificable(Image& img0, Registro_cambios& reg,
+				      const Position& p0, const Size2D& sz)
+{
+    reg.marca(Ventana{p0.i, p0.i + sz.rows, p0.j, p0.j + sz.cols});
+    return Subimage{img0, p0, sz};
+}
+
+
+
+/****************************************************************************
+ *
+ *   - FUNCIÓN: draw
+ *
+ *   - DESCRIPCIÓN: Las mismas funciones de dibujo que para Image,
+ *	apuntando en reg los pixeles modificados.
+ *
+ *   - COMENTARIOS: Las versiones que dibujan muchas figuras de golpe no
+ *	reparten el trabajo entre hilos (todos escribirían en el registro).
+ *
+ ****************************************************************************/
+namespace impl_of{
+template <typename Rasteriza>
+inline void draw_con_registro(Image& img, Registro_cambios& reg,
+			      const ColorRGB& color, Rasteriza rasteriza_)
+{
+    Pincel<Image> pincel{img, color};
+    Pincel_registro<Pincel<Image>> pr{pincel, reg};
+    rasteriza_(ventana(img), pr);
+}
+}// namespace impl_of
+
+
+inline void draw(Image& img, Registro_cambios& reg, const Segmento& s,
+						    const ColorRGB& color)
+{
+    impl_of::draw_con_registro(img, reg, color, [&](const Ventana& w, auto& p)
+	{ rasteriza(s, w, p); });
+}
+
+inline void draw(Image& img, Registro_cambios& reg,
+		 std::span<const Segmento> ss, const ColorRGB& color)
+{
+    impl_of::draw_con_registro(img, reg, color, [&](const Ventana& w, auto& p)
+	{
+	    for (const Segmento& s: ss)
+		rasteriza(s, w, p);
+	});
+}
+
+inline void draw_aa(Image& img, Registro_cambios& reg, const Segmento& s,
+						    const ColorRGB& color)
+{
+    impl_of::draw_con_registro(img, reg, color, [&](const Ventana& w, auto& p)
+	{ rasteriza_aa(s, w, p); });
+}
+
+inline void draw_grueso(Image& img, Registro_cambios& reg, const Segmento& s,
+			int ancho, const ColorRGB& color,
+			Extremo extremo = Extremo::redondo)
+{
+    impl_of::draw_con_registro(img, reg, color, [&](const Ventana& w, auto& p)
+	{ rasteriza_grueso(s, ancho, extremo, w, p); });
+}
+
+inline void draw(Image& img, Registro_cambios& reg, const Rectangulo& r,
+						    const ColorRGB& color)
+{
+    draw(img, r, color);
+    Position p0 = r.upper_left_corner();
+    Position pe = r.bottom_right_corner();
+    reg.marca(Ventana{p0.i, p0.i + 1, p0.j, pe.j + 1});
+    reg.marca(Ventana{pe.i, pe.i + 1, p0.j, pe.j + 1});
+    reg.marca(Ventana{p0.i, pe.i + 1, p0.j, p0.j + 1});
+    reg.marca(Ventana{p0.i, pe.i + 1, pe.j, pe.j + 1});
+}
+
+inline void draw_relleno(Image& img, Registro_cambios& reg,
+			 const Rectangulo& r, const ColorRGB& color)
+{
+    draw_relleno(img, r, color);
+    reg.marca(r);
+}
+
+inline void draw_circunferencia(Image& img, Registro_cambios& reg,
+				const Circulo& c, const ColorRGB& color)
+{
+    impl_of::draw_con_registro(img, reg, color, [&](const Ventana& w, auto& p)
+	{ rasteriza_circunferencia(c, false, w, p); });
+}
+
+inline void draw_circulo(Image& img, Registro_cambios& reg,
+			 const Circulo& c, const ColorRGB& color)
+{
+    impl_of::draw_con_registro(img, reg, color, [&](const Ventana& w, auto& p)
+	{ rasteriza_circunferencia(c, true, w, p); });
+}
+
+inline void draw_poligono_relleno(Image& img, Registro_cambios& reg,
+		    std::span<const Position> ps, const ColorRGB& color,
+		    Regla_relleno regla = Regla_relleno::par_impar)
+{
+    impl_of::draw_con_registro(img, reg, color, [&](const Ventana& w, auto& p)
+	{ rasteriza_poligono(ps, regla, w, p); });
+}
+
+
+}// namespace img
+
+#endif
+
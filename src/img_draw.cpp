@@ -18,6 +18,7 @@
 
 #include "img_draw.h"
 #include "img_view.h"
+#include "img_parallel.h"
 
 
 namespace img{
@@ -39,86 +40,147 @@ Image imagen_monocolor(Image::Ind rows, Image::Ind cols
  *
  *   - DESCRIPCIÓN: Dibuja un segmento usando el algoritmo de Bresenham
  *
- *   - PRECONDICIÓN: da por supuesto que el segmento pertenece a la imagen
- *
- *   - INPUT: Segmento s = segmento a dibujar
+ *   - INPUT: Segmento s = segmento a dibujar. Puede salirse de la imagen:
+ *			   solo se dibuja la parte que queda dentro.
  *	      color	 = color del que dibujamos el segmento
  *
- *   - OUTPUT: 
- *
  ****************************************************************************/
 void draw(Image& img, const Segmento& s, const ColorRGB& color)
 {   
-    using Ind = Image::Ind;
+    Pincel<Image> pincel{img, color};
+    rasteriza(s, ventana(img), pincel);
+}
+
 
-    // Caso degenerado
-    //if(es_un_punto(s)){	
-    if(s.A == s.B){	
-	img({s.A.i, s.A.j}) = color;
+// Dibuja las figuras de ss llamando a rasteriza_(s, ventana, pincel).
+// Reparte las filas de la imagen entre los hilos: cada pixel lo pinta un
+// único hilo, y lo hace en el orden en que están las figuras en ss. Por
+// eso el resultado es el mismo que dibujándolas una detrás de otra.
+template <typename Figura, typename Rasteriza>
+static void draw_por_bandas(Image& img, std::span<const Figura> ss,
+			    const ColorRGB& color, Rasteriza rasteriza_)
+{
+    if (ss.empty() or img.rows() == 0 or img.cols() == 0)
 	return;
-    }
-
-    // elegimos los extremos del segmento correctamente ("A < B")
-    Position A{0,0}, B{0,0};
-    if(s.A.i < s.B.i) { A = s.A; B = s.B; }
-    else{
-	if(s.A.i == s.B.i){
-	    if(s.A.j < s.B.j) {A = s.A; B = s.B;}
-	    else	      {A = s.B; B = s.A;}
-	}
-	else 
-	    {A = s.B; B = s.A;}
-    }
-
-    // Elegimos el driving axis
-    Ind incrI = B.i-A.i;
-    Ind incrJ = B.j-A.j;
-    Ind x0, x1, y0;
-    Ind incrX, incrY;
-    bool ejeXDA = true;	// el ejeX es el driving axis?
-
-    if(incrJ <= incrI)
-    {// el eje x es el driving axis
-	incrX = incrI;
-	incrY = incrJ;
-	x0 = A.i; x1 = B.i;
-	y0 = A.j;
-	ejeXDA = true;
-    }
-    else
-    {// el eje y es el driving axis
-	incrX = incrJ;
-	incrY = incrI;
-	x0 = A.j; x1 = B.j;
-	y0 = A.i;
-	ejeXDA = false;
-    }
-
-    // Algoritmo de Bresenham. Dibujamos la línea
-    Ind eps = incrY-incrX;
-    Ind y = y0;
-
-    // necesito incluir el signo de la pendiente para dibujar m < 0
-    int signo = 1;
-    if(incrY < 0) signo = -1;
-
-    for(Ind x = x0 ; x <= x1; ++x)
-    {
-	if(ejeXDA) img({x,y}) = color;
-	else img({y,x}) = color;
-
-	if(eps>= 0)
-	{
-	    y = y + signo;  // ++y ó --y
-	    eps-=incrX;
-	}
-	eps = eps + signo*incrY; // eps+= incrY; ó eps-=incrY
-    }
 
+    // Estimamos que cada figura pinta unos 32 pixeles: es el coste por
+    // fila que usa parallel_for para decidir cuántos hilos usar.
+    Ind coste = static_cast<Ind>(
+		    std::min<size_t>(ss.size() * 32 / img.rows() + 1, 1 << 16));
+
+    parallel_for(img.rows(), [&](Ind i0, Ind ie){
+	Pincel<Image> pincel{img, color};
+	Ventana w{i0, ie, 0, img.cols()};
 
+	for (const Figura& s: ss)
+	    rasteriza_(s, w, pincel);
+    }, coste);
 }
 
 
+void draw(Image& img, std::span<const Segmento> ss, const ColorRGB& color)
+{
+    draw_por_bandas(img, ss, color,
+	    [](const Segmento& s, const Ventana& w, Pincel<Image>& p)
+	    { rasteriza(s, w, p); });
+}
+
+
+void draw_aa(Image& img, const Segmento& s, const ColorRGB& color)
+{
+    Pincel<Image> pincel{img, color};
+    rasteriza_aa(s, ventana(img), pincel);
+}
+
+
+void draw_aa(Image& img, std::span<const Segmento> ss, const ColorRGB& color)
+{
+    draw_por_bandas(img, ss, color,
+	    [](const Segmento& s, const Ventana& w, Pincel<Image>& p)
+	    { rasteriza_aa(s, w, p); });
+}
+
+
+void draw_grueso(Image& img, const Segmento& s, int ancho,
+		 const ColorRGB& color, Extremo extremo)
+{
+    Pincel<Image> pincel{img, color};
+    rasteriza_grueso(s, ancho, extremo, ventana(img), pincel);
+}
+
+
+void draw_grueso(Image& img, std::span<const Segmento> ss, int ancho,
+		 const ColorRGB& color, Extremo extremo)
+{
+    draw_por_bandas(img, ss, color,
+	    [ancho, extremo](const Segmento& s, const Ventana& w,
+							Pincel<Image>& p)
+	    { rasteriza_grueso(s, ancho, extremo, w, p); });
+}
+
+
+void draw_circunferencia(Image& img, const Circulo& c, const ColorRGB& color)
+{
+    Pincel<Image> pincel{img, color};
+    rasteriza_circunferencia(c, false, ventana(img), pincel);
+}
+
+
+void draw_circunferencia(Image& img, std::span<const Circulo> cs,
+						const ColorRGB& color)
+{
+    draw_por_bandas(img, cs, color,
+	    [](const Circulo& c, const Ventana& w, Pincel<Image>& p)
+	    { rasteriza_circunferencia(c, false, w, p); });
+}
+
+
+void draw_circulo(Image& img, const Circulo& c, const ColorRGB& color)
+{
+    Pincel<Image> pincel{img, color};
+    rasteriza_circunferencia(c, true, ventana(img), pincel);
+}
+
+
+void draw_circulo(Image& img, std::span<const Circulo> cs,
+						const ColorRGB& color)
+{
+    draw_por_bandas(img, cs, color,
+	    [](const Circulo& c, const Ventana& w, Pincel<Image>& p)
+	    { rasteriza_circunferencia(c, true, w, p); });
+}
+
+
+void draw_elipse(Image& img, Position centro, Ind a, Ind b,
+						const ColorRGB& color)
+{
+    Pincel<Image> pincel{img, color};
+    rasteriza_elipse(centro, a, b, false, ventana(img), pincel);
+}
+
+
+void draw_elipse_rellena(Image& img, Position centro, Ind a, Ind b,
+						const ColorRGB& color)
+{
+    Pincel<Image> pincel{img, color};
+    rasteriza_elipse(centro, a, b, true, ventana(img), pincel);
+}
+
+
+void draw_relleno(Image& img, const Rectangulo& r, const ColorRGB& color)
+{
+    Pincel<Image> pincel{img, color};
+    rasteriza_rectangulo(r, ventana(img), pincel);
+}
+
+
+void draw_poligono_relleno(Image& img, std::span<const Position> ps,
+			   const ColorRGB& color, Regla_relleno regla)
+{
+    Pincel<Image> pincel{img, color};
+    rasteriza_poligono(ps, regla, ventana(img), pincel);
+}
+
 
 }// namespace
 
@@ -21,6 +21,14 @@
 #ifndef __IMG_DRAW_H__
 #define __IMG_DRAW_H__
 
+#include <span>
+#include <algorithm>
+#include <cstdlib>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
 #include "img_image.h"
 #include "img_view.h"
 
@@ -47,15 +55,843 @@ inline Image imagen_negra(Image::Ind rows, Image::Ind cols)
 inline Image imagen_negra(Image::Size2D sz)
 {return imagen_negra(sz.rows, sz.cols);}
 
+/****************************************************************************
+ *
+ *   - FUNCIÓN: rasteriza
+ *
+ *   - DESCRIPCIÓN: Calcula los pixeles de un segmento que están dentro de
+ *	una ventana y se los pasa a un pincel.
+ *
+ *	El pincel es quien pinta. Tiene que definir:
+ *	    punto(i, j)	    : pinta el pixel (i, j)
+ *	    punto(i, j, alfa) : pinta (i, j) con cobertura alfa en [0, 255]
+ *			      (solo lo usa rasteriza_aa)
+ *	    tramo_h(i, j0, je): pinta los pixeles [j0, je) de la fila i
+ *	    tramo_v(j, i0, ie): pinta los pixeles [i0, ie) de la columna j
+ *
+ *	Los segmentos horizontales y verticales se pasan enteros al pincel
+ *	como un único tramo. En el resto se recorre el eje de mayor
+ *	variación (driving axis) y la otra coordenada se calcula
+ *	incrementalmente (Bresenham).
+ *
+ *   - COMENTARIOS: El recorte se hace sobre el driving axis (como en
+ *	Liang-Barsky, pero con aritmética entera): se busca el intervalo de
+ *	u que cae dentro de la ventana y se empieza Bresenham en el primer
+ *	u de ese intervalo, calculando directamente el error inicial. De
+ *	esta forma los pixeles dibujados son exactamente los mismos que si
+ *	dibujásemos el segmento completo en una imagen infinita: recortar
+ *	no desplaza la recta.
+ *
+ ****************************************************************************/
+/// Ventana de recorte: pixeles [i0, ie) x [j0, je).
+struct Ventana{
+    Ind i0, ie;
+    Ind j0, je;
+};
+
+/// Ventana que cubre toda la imagen img0.
+template <typename Img>
+inline Ventana ventana(const Img& img0)
+{ return Ventana{0, img0.rows(), 0, img0.cols()}; }
+
+
+namespace impl_of{
+// floor(a/b) con b > 0
+inline long long floor_div(long long a, long long b)
+{
+    long long q = a / b;
+    return (a % b != 0 and a < 0)? q - 1: q;
+}
+
+// Primer u de [a, b] que cumple pred (pred monótona: false... true...).
+// Si no hay ninguno devuelve b + 1.
+template <typename Pred>
+Ind primero(Ind a, Ind b, Pred pred)
+{
+    ++b;
+    while (a < b){
+	Ind m = a + (b - a) / 2;
+	if (pred(m)) b = m;
+	else	     a = m + 1;
+    }
+    return a;
+}
+}// namespace impl_of
+
+
+template <typename Pincel>
+void rasteriza(const Segmento& s, const Ventana& w, Pincel& pincel)
+{
+    if (w.i0 >= w.ie or w.j0 >= w.je)
+	return;
+
+    // Horizontal (incluye el caso degenerado de un punto)
+    if (s.A.i == s.B.i){
+	if (s.A.i < w.i0 or s.A.i >= w.ie)
+	    return;
+
+	Ind j0 = std::max(std::min(s.A.j, s.B.j), w.j0);
+	Ind je = std::min(std::max(s.A.j, s.B.j) + 1, w.je);
+
+	if (j0 < je)
+	    pincel.tramo_h(s.A.i, j0, je);
+	return;
+    }
+
+    // Vertical
+    if (s.A.j == s.B.j){
+	if (s.A.j < w.j0 or s.A.j >= w.je)
+	    return;
+
+	Ind i0 = std::max(std::min(s.A.i, s.B.i), w.i0);
+	Ind ie = std::min(std::max(s.A.i, s.B.i) + 1, w.ie);
+
+	if (i0 < ie)
+	    pincel.tramo_v(s.A.j, i0, ie);
+	return;
+    }
+
+    // Caso general. u = driving axis, v = la otra coordenada.
+    bool eje_i = std::abs(s.B.i - s.A.i) >= std::abs(s.B.j - s.A.j);
+
+    Position A = s.A;
+    Position B = s.B;
+    auto u_de = [eje_i](const Position& p) {return eje_i? p.i: p.j;};
+    auto v_de = [eje_i](const Position& p) {return eje_i? p.j: p.i;};
+
+    if (u_de(A) > u_de(B))
+	std::swap(A, B);
+
+    long long Au = u_de(A);
+    long long Av = v_de(A);
+    long long du = u_de(B) - Au;	// > 0
+    long long dv = v_de(B) - Av;	// |dv| <= du
+
+    Ind u_min = eje_i? w.i0: w.j0;
+    Ind u_max = eje_i? w.ie: w.je;	// no incluido
+    Ind v_min = eje_i? w.j0: w.i0;
+    Ind v_max = eje_i? w.je: w.ie;	// no incluido
+
+    // v(u) = Av + round(dv*(u - Au)/du)
+    auto v = [&](Ind u) {
+	return Av + impl_of::floor_div(2*dv*(u - Au) + du, 2*du);
+    };
+
+    Ind u0 = static_cast<Ind>(std::max<long long>(Au, u_min));
+    Ind ue = static_cast<Ind>(std::min<long long>(Au + du, u_max - 1));
+    if (u0 > ue)
+	return;
+
+    // v es monótona: los u con v(u) dentro de la ventana son un intervalo
+    if (dv >= 0){
+	u0 = impl_of::primero(u0, ue, [&](Ind u){return v(u) >= v_min;});
+	ue = impl_of::primero(u0, ue, [&](Ind u){return v(u) >= v_max;}) - 1;
+    }
+    else{
+	u0 = impl_of::primero(u0, ue, [&](Ind u){return v(u) < v_max;});
+	ue = impl_of::primero(u0, ue, [&](Ind u){return v(u) < v_min;}) - 1;
+    }
+
+    if (u0 > ue)
+	return;
+
+    // Bresenham empezando en u0: r = resto de la división de v(u0)
+    long long dos_du = 2*du;
+    long long num = 2*dv*(u0 - Au) + du;
+    long long vv  = impl_of::floor_div(num, dos_du);
+    long long r	  = num - vv*dos_du;	// 0 <= r < 2*du
+    Ind vu = static_cast<Ind>(Av + vv);
+
+    for (Ind u = u0; u <= ue; ++u){
+	if (eje_i) pincel.punto(u, vu);
+	else	   pincel.punto(vu, u);
+
+	r += 2*dv;
+	if (r >= dos_du) {r -= dos_du; ++vu;}
+	else if (r < 0)	 {r += dos_du; --vu;}
+    }
+}
+
+
+/****************************************************************************
+ *
+ *   - FUNCIÓN: rasteriza_aa
+ *
+ *   - DESCRIPCIÓN: Segmento con antialiasing (algoritmo de Xiaolin Wu).
+ *	Por cada u del driving axis la recta pasa entre los pixeles v y
+ *	v + 1: los pintamos a los dos con una cobertura proporcional a lo
+ *	cerca que pase la recta de cada uno (las dos coberturas suman 255).
+ *
+ *   - COMENTARIOS: Como los extremos de Segmento son enteros no hace falta
+ *	el tratamiento especial de los extremos del algoritmo original.
+ *	v se calcula en coma fija 32.32: en el bucle no hay ni floats ni
+ *	divisiones. Al recortar se calcula x(u0) = (u0 - Au)*paso, que es
+ *	justo lo que se obtendría sumando paso desde Au: recortar no cambia
+ *	la recta.
+ *
+ ****************************************************************************/
+template <typename Pincel>
+void rasteriza_aa(const Segmento& s, const Ventana& w, Pincel& pincel)
+{
+    if (w.i0 >= w.ie or w.j0 >= w.je)
+	return;
+
+    if (s.A == s.B){
+	if (w.i0 <= s.A.i and s.A.i < w.ie and w.j0 <= s.A.j and s.A.j < w.je)
+	    pincel.punto(s.A.i, s.A.j, 255);
+	return;
+    }
+
+    bool eje_i = std::abs(s.B.i - s.A.i) >= std::abs(s.B.j - s.A.j);
+
+    Position A = s.A;
+    Position B = s.B;
+    auto u_de = [eje_i](const Position& p) {return eje_i? p.i: p.j;};
+    auto v_de = [eje_i](const Position& p) {return eje_i? p.j: p.i;};
+
+    if (u_de(A) > u_de(B))
+	std::swap(A, B);
+
+    long long Au = u_de(A);
+    long long Av = v_de(A);
+    long long du = u_de(B) - Au;	// > 0
+    long long dv = v_de(B) - Av;	// |dv| <= du
+
+    Ind u_min = eje_i? w.i0: w.j0;
+    Ind u_max = eje_i? w.ie: w.je;
+    Ind v_min = eje_i? w.j0: w.i0;
+    Ind v_max = eje_i? w.je: w.ie;
+
+    // v(u) = Av + dv*(u - Au)/du en coma fija 32.32 (x = parte que se
+    // suma a Av). Pintamos floor(v(u)) y floor(v(u)) + 1.
+    // Precondición: |coordenadas| < 2^30 (para que no haya overflow).
+    constexpr int F = 32;
+    long long paso = impl_of::floor_div((dv << F) + du / 2, du);
+    auto x = [&](Ind u) {return (u - Au) * paso;};
+    auto v = [&](Ind u) {return Av + (x(u) >> F);};
+
+    Ind u0 = static_cast<Ind>(std::max<long long>(Au, u_min));
+    Ind ue = static_cast<Ind>(std::min<long long>(Au + du, u_max - 1));
+    if (u0 > ue)
+	return;
+
+    if (dv >= 0){
+	u0 = impl_of::primero(u0, ue, [&](Ind u){return v(u) >= v_min - 1;});
+	ue = impl_of::primero(u0, ue, [&](Ind u){return v(u) >= v_max;}) - 1;
+    }
+    else{
+	u0 = impl_of::primero(u0, ue, [&](Ind u){return v(u) < v_max;});
+	ue = impl_of::primero(u0, ue, [&](Ind u){return v(u) < v_min - 1;}) - 1;
+    }
+
+    if (u0 > ue)
+	return;
+
+    // Bucle: solo sumas y desplazamientos
+    long long xu = x(u0);
+    for (Ind u = u0; u <= ue; ++u, xu += paso){
+	Ind vu	 = static_cast<Ind>(Av + (xu >> F));
+	int alfa = static_cast<int>((xu >> (F - 8)) & 0xFF); // cobertura de v + 1
+
+	if (alfa != 255 and v_min <= vu and vu < v_max){
+	    if (eje_i) pincel.punto(u, vu, 255 - alfa);
+	    else       pincel.punto(vu, u, 255 - alfa);
+	}
+
+	if (alfa != 0 and v_min <= vu + 1 and vu + 1 < v_max){
+	    if (eje_i) pincel.punto(u, vu + 1, alfa);
+	    else       pincel.punto(vu + 1, u, alfa);
+	}
+    }
+}
+
+
+/****************************************************************************
+ *
+ *   - FUNCIÓN: rasteriza_grueso
+ *
+ *   - DESCRIPCIÓN: Segmento de ancho 'ancho' pixeles.
+ *
+ *	El segmento grueso es un polígono convexo: el rectángulo de ancho
+ *	'ancho' centrado en el segmento (alargado ancho/2 por cada lado si
+ *	los extremos son cuadrados) más dos círculos de diámetro 'ancho' en
+ *	los extremos si son redondos. Pintamos los pixeles cuyo centro cae
+ *	dentro.
+ *
+ *   - COMENTARIOS: Al ser convexo, cada fila es un único tramo horizontal.
+ *	Calculamos los extremos del tramo una vez por fila y lo pintamos con
+ *	pincel.tramo_h: no hay cálculos por pixel.
+ *
+ ****************************************************************************/
+/// Forma de los extremos de un segmento grueso.
+enum class Extremo {cuadrado, redondo};
+
+template <typename Pincel>
+void rasteriza_grueso(const Segmento& s, int ancho, Extremo extremo,
+		      const Ventana& w, Pincel& pincel)
+{
+    if (ancho <= 1){
+	rasteriza(s, w, pincel);
+	return;
+    }
+
+    if (w.i0 >= w.ie or w.j0 >= w.je)
+	return;
+
+    // Trabajamos con x = j, y = i
+    double r  = ancho / 2.0;
+    double x0 = s.A.j, y0 = s.A.i;
+    double x1 = s.B.j, y1 = s.B.i;
+
+    double dx = x1 - x0, dy = y1 - y0;
+    double l  = std::sqrt(dx*dx + dy*dy);
+    if (l == 0.0) {dx = 1.0; dy = 0.0;}
+    else	  {dx /= l; dy /= l;}
+
+    if (extremo == Extremo::cuadrado){
+	x0 -= dx*r; y0 -= dy*r;
+	x1 += dx*r; y1 += dy*r;
+    }
+
+    double nx = -dy*r, ny = dx*r;   // normal de longitud r
+    double px[4] = {x0 + nx, x1 + nx, x1 - nx, x0 - nx};
+    double py[4] = {y0 + ny, y1 + ny, y1 - ny, y0 - ny};
+
+    double ymin = std::min({py[0], py[1], py[2], py[3]});
+    double ymax = std::max({py[0], py[1], py[2], py[3]});
+
+    if (extremo == Extremo::redondo){
+	ymin = std::min(ymin, std::min(y0, y1) - r);
+	ymax = std::max(ymax, std::max(y0, y1) + r);
+    }
+
+    constexpr double eps = 1e-9;
+    Ind i0 = std::max(w.i0, static_cast<Ind>(std::ceil(ymin - eps)));
+    Ind ie = std::min(w.ie, static_cast<Ind>(std::floor(ymax + eps)) + 1);
+
+    for (Ind i = i0; i < ie; ++i){
+	double xmin = std::numeric_limits<double>::max();
+	double xmax = std::numeric_limits<double>::lowest();
+
+	// Corte de la fila con los lados del rectángulo
+	for (int k = 0; k < 4; ++k){
+	    int k1 = (k + 1) % 4;
+	    double ya = py[k], yb = py[k1];
+
+	    if (std::min(ya, yb) - eps <= i and i <= std::max(ya, yb) + eps){
+		if (std::abs(yb - ya) < eps){ // lado horizontal
+		    xmin = std::min({xmin, px[k], px[k1]});
+		    xmax = std::max({xmax, px[k], px[k1]});
+		}
+		else{
+		    double x = px[k] + (i - ya) * (px[k1] - px[k]) / (yb - ya);
+		    xmin = std::min(xmin, x);
+		    xmax = std::max(xmax, x);
+		}
+	    }
+	}
+
+	// Corte con los círculos de los extremos
+	if (extremo == Extremo::redondo){
+	    for (auto [cx, cy]: {std::pair{x0, y0}, std::pair{x1, y1}}){
+		double d = i - cy;
+		if (std::abs(d) <= r){
+		    double h = std::sqrt(r*r - d*d);
+		    xmin = std::min(xmin, cx - h);
+		    xmax = std::max(xmax, cx + h);
+		}
+	    }
+	}
+
+	if (xmin > xmax)
+	    continue;
+
+	Ind j0 = std::max(w.j0, static_cast<Ind>(std::ceil(xmin - eps)));
+	Ind je = std::min(w.je, static_cast<Ind>(std::floor(xmax + eps)) + 1);
+
+	if (j0 < je)
+	    pincel.tramo_h(i, j0, je);
+    }
+}
+
+
+/****************************************************************************
+ *
+ *   - FUNCIÓN: rasteriza_circunferencia, rasteriza_elipse
+ *
+ *   - DESCRIPCIÓN: Circunferencias y elipses (algoritmo del punto medio).
+ *	Si relleno == true se pinta también el interior.
+ *
+ *   - COMENTARIOS: Solo se calcula un octante de la circunferencia (un
+ *	cuadrante de la elipse) con aritmética entera; el resto se obtiene
+ *	por simetría. Cada pixel se pinta una sola vez (importante si el
+ *	pincel mezcla colores).
+ *
+ *	En las figuras rellenas cada fila es un único tramo horizontal que
+ *	se pasa a pincel.tramo_h. El relleno contiene exactamente a los
+ *	pixeles del contorno.
+ *
+ ****************************************************************************/
+/// Circunferencia (o círculo) de centro 'centro' y radio 'radio'.
+struct Circulo{
+    Position centro;
+    Ind radio;
+};
+
+
+namespace impl_of{
+// Pinta el tramo [j - h, j + h] de la fila i, recortado a la ventana.
+template <typename Pincel>
+inline void tramo_centrado(Ind i, Ind j, Ind h, const Ventana& w,
+							    Pincel& pincel)
+{
+    if (i < w.i0 or i >= w.ie)
+	return;
+
+    Ind j0 = std::max(j - h, w.j0);
+    Ind je = std::min(j + h + 1, w.je);
+    if (j0 < je)
+	pincel.tramo_h(i, j0, je);
+}
+
+// Pinta los puntos (i ± di, j ± dj) sin repetir ninguno.
+template <typename Pincel>
+inline void simetricos4(Ind i, Ind j, Ind di, Ind dj, const Ventana& w,
+							    Pincel& pincel)
+{
+    auto punto = [&](Ind a, Ind b){
+	if (w.i0 <= a and a < w.ie and w.j0 <= b and b < w.je)
+	    pincel.punto(a, b);
+    };
+
+    punto(i + di, j + dj);
+    if (dj != 0)		punto(i + di, j - dj);
+    if (di != 0)		punto(i - di, j + dj);
+    if (di != 0 and dj != 0)	punto(i - di, j - dj);
+}
+
+// ¿Está el rectángulo [i0, ie] x [j0, je] fuera de la ventana?
+inline bool fuera(Ind i0, Ind ie, Ind j0, Ind je, const Ventana& w)
+{ return ie < w.i0 or i0 >= w.ie or je < w.j0 or j0 >= w.je; }
+}// namespace impl_of
+
+
+template <typename Pincel>
+void rasteriza_circunferencia(const Circulo& c, bool relleno,
+			      const Ventana& w, Pincel& pincel)
+{
+    Ind ci = c.centro.i;
+    Ind cj = c.centro.j;
+    Ind r  = c.radio;
+
+    if (r < 0 or impl_of::fuera(ci - r, ci + r, cj - r, cj + r, w))
+	return;
+
+    // Filas ci ± di: tramo de semiancho dj o sus dos extremos
+    auto pinta = [&](Ind di, Ind dj){
+	if (relleno){
+	    impl_of::tramo_centrado(ci + di, cj, dj, w, pincel);
+	    if (di != 0)
+		impl_of::tramo_centrado(ci - di, cj, dj, w, pincel);
+	}
+	else
+	    impl_of::simetricos4(ci, cj, di, dj, w, pincel);
+    };
+
+    // Octante 0 <= x <= y: la x crece en cada paso, la y a veces decrece.
+    Ind x = 0;
+    Ind y = r;
+    Ind d = 1 - r;
+
+    while (x <= y){
+	pinta(x, y);		    // filas ci ± x
+
+	// Las filas ci ± y: sin rellenar se pintan todos los puntos; si
+	// rellenamos basta con el tramo más ancho, que es el último antes
+	// de que la y decrezca.
+	if (x != y and (!relleno or d >= 0))
+	    pinta(y, x);
+
+	if (d < 0)
+	    d += 2*x + 3;
+	else{
+	    d += 2*(x - y) + 5;
+	    --y;
+	}
+
+	++x;
+    }
+}
+
+
+template <typename Pincel>
+void rasteriza_elipse(Position centro, Ind a, Ind b, bool relleno,
+		      const Ventana& w, Pincel& pincel)
+{
+    Ind ci = centro.i;
+    Ind cj = centro.j;
+
+    if (a < 0 or b < 0 or impl_of::fuera(ci - b, ci + b, cj - a, cj + a, w))
+	return;
+
+    if (b == 0){ // degenerada: un segmento horizontal
+	impl_of::tramo_centrado(ci, cj, a, w, pincel);
+	return;
+    }
+
+    auto pinta = [&](Ind x, Ind y){ // filas ci ± y
+	if (relleno){
+	    impl_of::tramo_centrado(ci + y, cj, x, w, pincel);
+	    if (y != 0)
+		impl_of::tramo_centrado(ci - y, cj, x, w, pincel);
+	}
+	else
+	    impl_of::simetricos4(ci, cj, y, x, w, pincel);
+    };
+
+    // Trabajamos con x = j - cj, y = ci - i. Todas las variables de
+    // decisión están multiplicadas por 4 para que sean enteras.
+    long long a2 = static_cast<long long>(a) * a;
+    long long b2 = static_cast<long long>(b) * b;
+
+    long long x = 0;
+    long long y = b;
+    long long dx = 0;		// 2*b2*x
+    long long dy = 2*a2*y;	// 2*a2*y
+
+    // Región 1: pendiente > -1, la x crece en cada paso
+    long long d1 = 4*b2 - 4*a2*b + a2;
+    while (dx < dy){
+	if (!relleno)
+	    pinta(x, y);
+
+	if (d1 < 0){
+	    ++x;
+	    dx += 2*b2;
+	    d1 += 4*(dx + b2);
+	}
+	else{
+	    if (relleno)    // último (el más ancho) de la fila y
+		pinta(x, y);
+	    ++x; --y;
+	    dx += 2*b2;
+	    dy -= 2*a2;
+	    d1 += 4*(dx - dy + b2);
+	}
+    }
+
+    // Región 2: pendiente < -1, la y decrece en cada paso
+    long long d2 = b2*(2*x + 1)*(2*x + 1) + 4*a2*(y - 1)*(y - 1) - 4*a2*b2;
+    while (y > 0){
+	pinta(x, y);
+
+	if (d2 > 0){
+	    --y;
+	    dy -= 2*a2;
+	    d2 += 4*(a2 - dy);
+	}
+	else{
+	    --y; ++x;
+	    dx += 2*b2;
+	    dy -= 2*a2;
+	    d2 += 4*(dx - dy + a2);
+	}
+    }
+
+    // Fila central. En las elipses muy planas el algoritmo llega a y = 0
+    // antes que a x = a: completamos la fila hasta x = a.
+    if (relleno)
+	pinta(std::max<long long>(x, a), 0);
+    else{
+	do { pinta(x, 0); } while (++x <= a);
+    }
+}
+
+
+/****************************************************************************
+ *
+ *   - FUNCIÓN: rasteriza_poligono
+ *
+ *   - DESCRIPCIÓN: Rellena el polígono de vértices ps (cóncavo o convexo,
+ *	puede cortarse a sí mismo).
+ *
+ *	Se pintan los pixeles cuyo centro está dentro del polígono. Los
+ *	pixeles del borde izquierdo y superior se consideran dentro, los del
+ *	derecho e inferior fuera: el rectángulo de vértices (0,0), (0,4),
+ *	(3,4), (3,0) pinta 3 x 4 pixeles, y dos polígonos que comparten un
+ *	lado no se pisan.
+ *
+ *   - COMENTARIOS: Algoritmo de la línea de barrido con tabla de lados
+ *	activos. Para cada fila i solo miramos los lados que la cortan; el
+ *	punto de corte de cada lado se actualiza de una fila a la siguiente
+ *	de forma exacta, con aritmética entera y sin divisiones. Los tramos
+ *	de cada fila se pasan a pincel.tramo_h.
+ *
+ ****************************************************************************/
+/// Regla para decidir qué puntos están dentro de un polígono que se
+/// corta a sí mismo.
+enum class Regla_relleno {
+    par_impar,	// dentro si una semirrecta lo corta un número impar de veces
+    no_cero	// dentro si el número de vueltas (winding number) no es 0
+};
+
+
+namespace impl_of{
+// Lado de un polígono que corta a las filas [i0, ie).
+// En la fila i corta en x = j0 + (i - i0) * dj / di. Guardamos
+// j = ceil(x) = primer pixel a la derecha del corte y el resto r con
+// j*di - r = numerador de x (0 <= r < di).
+struct Lado_activo{
+    Ind ie;
+    long long j, r;
+    long long di;
+    long long paso_j, paso_r;	// dj = paso_j * di + paso_r
+    int sentido;		// +1 si baja, -1 si sube
+
+    // Pasa a la fila siguiente
+    void avanza()
+    {
+	j += paso_j;
+	r -= paso_r;
+	if (r < 0){
+	    ++j;
+	    r += di;
+	}
+    }
+};
+}// namespace impl_of
+
+
+template <typename Pincel>
+void rasteriza_poligono(std::span<const Position> ps, Regla_relleno regla,
+			const Ventana& w, Pincel& pincel)
+{
+    using impl_of::Lado_activo;
+
+    struct Lado{
+	Position p0, pe;    // p0.i < pe.i
+	int sentido;
+    };
+
+    // Tabla de lados (sin los horizontales), ordenados por la fila de arriba
+    std::vector<Lado> lados;
+    lados.reserve(ps.size());
+
+    Ind imin = w.ie, imax = w.i0;
+    for (size_t k = 0; k < ps.size(); ++k){
+	Position a = ps[k];
+	Position b = ps[(k + 1) % ps.size()];
+
+	if (a.i == b.i)
+	    continue;
+
+	if (a.i < b.i) lados.push_back(Lado{a, b, +1});
+	else	       lados.push_back(Lado{b, a, -1});
+
+	imin = std::min(imin, lados.back().p0.i);
+	imax = std::max(imax, lados.back().pe.i);
+    }
+
+    std::sort(lados.begin(), lados.end(), [](const Lado& x, const Lado& y)
+	    { return x.p0.i < y.p0.i; });
+
+    Ind i0 = std::max(imin, w.i0);
+    Ind ie = std::min(imax, w.ie);
+
+    std::vector<Lado_activo> activos;
+    size_t siguiente = 0;   // primer lado de la tabla que no ha entrado
+
+    for (Ind i = i0; i < ie; ++i){
+	// Quitamos los que acaban y avanzamos el resto
+	std::erase_if(activos, [i](const Lado_activo& l){return l.ie <= i;});
+
+	// Añadimos los que empiezan (o empezaban antes de la ventana)
+	for (; siguiente < lados.size() and lados[siguiente].p0.i <= i;
+								++siguiente){
+	    const Lado& l = lados[siguiente];
+	    if (l.pe.i <= i)
+		continue;
+
+	    long long di = l.pe.i - l.p0.i;
+	    long long dj = l.pe.j - l.p0.j;
+	    long long num = l.p0.j * di + (i - l.p0.i) * dj;
+
+	    Lado_activo a;
+	    a.ie = l.pe.i;
+	    a.di = di;
+	    a.j  = -impl_of::floor_div(-num, di);   // ceil
+	    a.r  = a.j * di - num;
+	    a.paso_j = impl_of::floor_div(dj, di);
+	    a.paso_r = dj - a.paso_j * di;
+	    a.sentido = l.sentido;
+
+	    activos.push_back(a);
+	}
+
+	// Ordenamos por el punto de corte (inserción: casi siempre están
+	// ya ordenados de la fila anterior).
+	for (size_t k = 1; k < activos.size(); ++k)
+	    for (size_t m = k; m > 0 and activos[m].j < activos[m - 1].j; --m)
+		std::swap(activos[m], activos[m - 1]);
+
+	// Tramos
+	int vueltas = 0;
+	for (size_t k = 0; k + 1 < activos.size(); ++k){
+	    vueltas += activos[k].sentido;
+
+	    bool dentro = (regla == Regla_relleno::par_impar)? (k % 2 == 0)
+							      : (vueltas != 0);
+	    if (!dentro)
+		continue;
+
+	    long long j0 = std::max<long long>(activos[k].j, w.j0);
+	    long long je = std::min<long long>(activos[k + 1].j, w.je);
+
+	    if (j0 < je)
+		pincel.tramo_h(i, static_cast<Ind>(j0), static_cast<Ind>(je));
+	}
+
+	for (auto& a: activos)
+	    a.avanza();
+    }
+}
+
+
+/// Rellena el rectángulo r (incluidos sus bordes).
+template <typename Pincel>
+void rasteriza_rectangulo(const Rectangulo& r, const Ventana& w,
+							Pincel& pincel)
+{
+    Position p0 = r.upper_left_corner();
+    Position pe = r.bottom_right_corner();
+
+    Ind i0 = std::max(std::min(p0.i, pe.i), w.i0);
+    Ind ie = std::min(std::max(p0.i, pe.i) + 1, w.ie);
+    Ind j0 = std::max(std::min(p0.j, pe.j), w.j0);
+    Ind je = std::min(std::max(p0.j, pe.j) + 1, w.je);
+
+    if (j0 >= je)
+	return;
+
+    for (Ind i = i0; i < ie; ++i)
+	pincel.tramo_h(i, j0, je);
+}
+
+
+/// Pincel que pinta de un color en una imagen.
+/// Img = Image o Subimage (sus filas son contiguas en memoria).
+template <typename Img>
+class Pincel{
+public:
+    Pincel(Img& img0, const ColorRGB& color) : img_{img0}, color_{color} {}
+
+    void punto(Ind i, Ind j) {img_(i, j) = color_;}
+
+    /// Pinta (i, j) con una cobertura alfa en [0, 255].
+    void punto(Ind i, Ind j, int alfa)
+    { img_(i, j) = mezcla(img_(i, j), color_, alfa); }
+
+    void tramo_h(Ind i, Ind j0, Ind je)
+    {
+	ColorRGB* p = &img_(i, j0);
+	std::fill(p, p + (je - j0), color_);
+    }
+
+    void tramo_v(Ind j, Ind i0, Ind ie)
+    {
+	ColorRGB* p = &img_(i0, j);
+	if (ie - i0 == 1){
+	    *p = color_;
+	    return;
+	}
+
+	auto salto = &img_(i0 + 1, j) - p;  // distancia entre filas
+	for (Ind i = i0; i < ie; ++i, p += salto)
+	    *p = color_;
+    }
+
+private:
+    Img& img_;
+    ColorRGB color_;
+};
+
+
 /****************************************************************************
  *
  *   - FUNCIÓN: draw
  *
  *   - DESCRIPCIÓN: Funciones de dibujo
  *
+ *   - COMENTARIOS: Los segmentos pueden salirse de la imagen: solo se
+ *	dibuja la parte que queda dentro.
+ *
  ****************************************************************************/
 void draw(Image& img, const Segmento& s, const ColorRGB& color);
 
+/// Dibuja todos los segmentos de ss del mismo color.
+/// Si hay muchos segmentos se reparten las filas de la imagen entre
+/// varios hilos (cada hilo dibuja la parte de todos los segmentos que
+/// cae en sus filas).
+void draw(Image& img, std::span<const Segmento> ss, const ColorRGB& color);
+
+
+/// Dibuja el segmento s con antialiasing.
+void draw_aa(Image& img, const Segmento& s, const ColorRGB& color);
+
+/// Dibuja todos los segmentos de ss con antialiasing. Si se cruzan, en los
+/// pixeles comunes se mezclan en el orden en que están en ss.
+void draw_aa(Image& img, std::span<const Segmento> ss, const ColorRGB& color);
+
+/// Dibuja el segmento s con un ancho de 'ancho' pixeles.
+void draw_grueso(Image& img, const Segmento& s, int ancho,
+		 const ColorRGB& color, Extremo extremo = Extremo::redondo);
+
+/// Dibuja todos los segmentos de ss con un ancho de 'ancho' pixeles.
+void draw_grueso(Image& img, std::span<const Segmento> ss, int ancho,
+		 const ColorRGB& color, Extremo extremo = Extremo::redondo);
+
+
+/// Dibuja la circunferencia c (solo el borde).
+void draw_circunferencia(Image& img, const Circulo& c, const ColorRGB& color);
+
+/// Dibuja todas las circunferencias de cs.
+void draw_circunferencia(Image& img, std::span<const Circulo> cs,
+						const ColorRGB& color);
+
+/// Dibuja el círculo c relleno.
+void draw_circulo(Image& img, const Circulo& c, const ColorRGB& color);
+
+/// Dibuja todos los círculos de cs rellenos.
+void draw_circulo(Image& img, std::span<const Circulo> cs,
+						const ColorRGB& color);
+
+/// Dibuja la elipse de centro 'centro' y semiejes a (horizontal) y b
+/// (vertical).
+void draw_elipse(Image& img, Position centro, Ind a, Ind b,
+						const ColorRGB& color);
+
+/// Dibuja la elipse de centro 'centro' y semiejes a y b rellena.
+void draw_elipse_rellena(Image& img, Position centro, Ind a, Ind b,
+						const ColorRGB& color);
+
+
+/// Rellena el rectángulo r (incluidos sus bordes).
+void draw_relleno(Image& img, const Rectangulo& r, const ColorRGB& color);
+
+/// Rellena el polígono de vértices ps. Ver rasteriza_poligono.
+void draw_poligono_relleno(Image& img, std::span<const Position> ps,
+			   const ColorRGB& color,
+			   Regla_relleno regla = Regla_relleno::par_impar);
+
+/// Rellena el triángulo de vértices A, B y C.
+inline void draw_triangulo_relleno(Image& img, const Position& A,
+				   const Position& B, const Position& C,
+				   const ColorRGB& color)
+{
+    Position ps[3] = {A, B, C};
+    draw_poligono_relleno(img, ps, color);
+}
+
 
 inline void draw(Image& img, const Rectangulo& r, const ColorRGB& color)
 {
@@ -71,10 +907,18 @@ inline void draw(Image& img, const Rectangulo& r, const ColorRGB& color)
 }
 
 inline void draw_lineaH(Image& img, Image::Ind i, const ColorRGB& c)
-{ draw(img, Segmento{{i, 0}, {i, img.cols()-1}}, c); }
+{
+    Pincel<Image> pincel{img, c};
+    if (0 <= i and i < img.rows() and img.cols() > 0)
+	pincel.tramo_h(i, 0, img.cols());
+}
 
 inline void draw_lineaV(Image& img, Image::Ind j, const ColorRGB& c)
-{ draw(img, Segmento{{0, j}, {img.rows()-1, j}}, c); }
+{
+    Pincel<Image> pincel{img, c};
+    if (0 <= j and j < img.cols() and img.rows() > 0)
+	pincel.tramo_v(j, 0, img.rows());
+}
 
 
 // dibuja un eje horizontal que pasa por p
@@ -150,23 +994,25 @@ inline void draw_segmento(Image_xy<1,1>& img_xy
 /***************************************************************************
  *		    FUNCIONES DE DIBUJO PARA Image_rt
  ***************************************************************************/
-/// Dibuja la recta rho = cte de color c.
+/// Dibuja la recta theta = cte de color c (desde r = 0 hasta r_max).
+/// Solo se calcula el extremo del rayo; el resto se dibuja con Bresenham.
 inline void draw_rayo(  Image_rt& img_rt
 			, double theta, const ColorRGB& c)
 {
-    for (double r = 0.0; r <= img_rt.r_max(); ++r)
-	img_rt(r, theta) = c;
+    auto [x, y] = alp::polares2cartesianas(img_rt.r_max(), theta);
+    draw(img_rt.image(), Segmento{img_rt.centro(), img_rt.posicion(x, y)}, c);
 }
 
 /// Dibuja una circunferencia de radio r de color c.
-/// incr_theta indica de cuánto en cuánto queremos aumentar el ángulo theta.
-// DUDA: ¿se puede estimar incr_theta a partir de r y r_max? Seguramente.
+/// El radio se redondea al entero más próximo.
+/// incr_theta ya no tiene ningún efecto: la circunferencia se dibuja con
+/// Bresenham, sin huecos. Se mantiene para no romper el código que lo pasa.
 inline void draw_circunferencia(  Image_rt& img_rt
 			, double r, const ColorRGB& c
-			, double incr_theta = 0.1)
+			, [[maybe_unused]] double incr_theta = 0.1)
 {
-    for (double theta = 0.0; theta < 360.0; theta += incr_theta)
-	img_rt(r, theta) = c;
+    Circulo circ{img_rt.centro(), static_cast<Ind>(std::lround(r))};
+    draw_circunferencia(img_rt.image(), circ, c);
 }
 
 
@@ -0,0 +1,221 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#ifndef __IMG_FLOOD_FILL_H__
+#define __IMG_FLOOD_FILL_H__
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Relleno de regiones (flood fill) y crecimiento de
+ *	regiones a partir de una semilla.
+ *
+ *   - COMENTARIOS: Recorrer la región pixel a pixel con un Iterator2D
+ *	obliga a comprobar en cada paso si estamos dentro de la imagen y si
+ *	ya hemos visitado el pixel. Aquí procesamos tramos horizontales
+ *	completos: una vez encontrado un pixel de la región lo extendemos a
+ *	izquierda y derecha y procesamos todo el tramo de golpe. Los tramos
+ *	de las filas de arriba y abajo que quedan por mirar se guardan en una
+ *	pila (no hay recursión).
+ *
+ *	    // Pintamos de rojo la región del color de (10, 20)
+ *	    rellena(img, Position{10, 20}, ColorRGB::rojo());
+ *
+ *	    // Etiquetamos la región de pixeles oscuros que contiene a p
+ *	    crece_region(img, p,
+ *		    [](const ColorRGB& c){ return intensidad(c) < 50;},
+ *		    [&](Ind i, Ind j0, Ind je){
+ *			std::fill(&mask(i, j0), &mask(i, j0) + (je - j0), 1);});
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "img_image.h"
+#include "img_iterator2D.h"
+#include "img_components.h"	// Componente, Conectividad
+
+namespace img{
+
+namespace impl_of{
+// Tramos [j0, je) ya visitados de cada fila, ordenados y disjuntos.
+// Ocupa memoria proporcional al número de tramos de la región (y no al
+// tamaño de la imagen): rellenar una región pequeña de una imagen grande
+// no obliga a reservar e inicializar un mapa de toda la imagen.
+class Tramos_visitados{
+public:
+    using Tramo = std::pair<Ind, Ind>;
+    using iterator = std::vector<Tramo>::iterator;
+
+    explicit Tramos_visitados(Ind rows) : filas_(rows) {}
+
+    // Primer tramo de la fila i que termina después de j.
+    iterator siguiente(Ind i, Ind j)
+    {
+	auto& f = filas_[i];
+	return std::upper_bound(f.begin(), f.end(), j,
+			    [](Ind x, const Tramo& t) { return x < t.second; });
+    }
+
+    iterator begin(Ind i) {return filas_[i].begin();}
+    iterator end(Ind i) {return filas_[i].end();}
+
+    // Añade [j0, je) antes de p (p = siguiente(i, j0))
+    void inserta(Ind i, iterator p, Ind j0, Ind je)
+    { filas_[i].insert(p, Tramo{j0, je}); }
+
+private:
+    std::vector<std::vector<Tramo>> filas_;
+};
+}// namespace impl_of
+
+
+/// Crece la región que contiene a 'semilla' formada por los pixeles x que
+/// cumplen pertenece(x).
+///
+/// Por cada tramo horizontal [j0, je) de la fila i de la región se llama
+/// una vez a accion(i, j0, je). Cada pixel se procesa una sola vez, aunque
+/// accion no modifique la imagen.
+///
+/// Devuelve el número de pixeles de la región y el rectángulo que la
+/// contiene. Si la semilla no pertenece a la región devuelve npixels == 0.
+///
+/// Precondición: la semilla está dentro de la imagen.
+template <typename Img, typename Pred, typename Accion>
+Componente crece_region(const Img& img0, Position semilla,
+			Pred pertenece, Accion accion,
+			Conectividad con = Conectividad::cuatro)
+{
+    Ind rows = img0.rows();
+    Ind cols = img0.cols();
+
+    Componente res{0, semilla, semilla};
+
+    if (!pertenece(img0(semilla.i, semilla.j)))
+	return res;
+
+    // Para 8-conectividad los tramos vecinos son una columna más anchos
+    // por cada lado.
+    Ind d = (con == Conectividad::ocho? 1: 0);
+
+    impl_of::Tramos_visitados visitado{rows};
+
+    struct Tramo{ Ind i, j0, je; };   // falta mirar [j0, je) de la fila i
+    std::vector<Tramo> pila{Tramo{semilla.i, semilla.j, semilla.j + 1}};
+
+    while (!pila.empty()){
+	Tramo t = pila.back();
+	pila.pop_back();
+
+	if (t.i < 0 or t.i >= rows)
+	    continue;
+
+	Ind i = t.i;
+	Ind j  = std::max(t.j0, Ind{0});
+	Ind je = std::min(t.je, cols);
+
+	while (j < je){
+	    auto p = visitado.siguiente(i, j);
+
+	    if (p != visitado.end(i) and p->first <= j){ // ya visitado
+		j = p->second;
+		continue;
+	    }
+
+	    if (!pertenece(img0(i, j))){
+		++j;
+		continue;
+	    }
+
+	    // Extendemos el tramo a izquierda y derecha, hasta los tramos ya
+	    // visitados
+	    Ind lim_izq = (p != visitado.begin(i)? std::prev(p)->second: 0);
+	    Ind lim_der = (p != visitado.end(i)? p->first: cols);
+
+	    Ind l = j;
+	    while (l > lim_izq and pertenece(img0(i, l - 1)))
+		--l;
+
+	    Ind r = j + 1;
+	    while (r < lim_der and pertenece(img0(i, r)))
+		++r;
+
+	    visitado.inserta(i, p, l, r);
+	    accion(i, l, r);
+
+	    res.npixels += r - l;
+	    res.p0.i = std::min(res.p0.i, i);
+	    res.pe.i = std::max(res.pe.i, i);
+	    res.p0.j = std::min(res.p0.j, l);
+	    res.pe.j = std::max(res.pe.j, r - 1);
+
+	    pila.push_back(Tramo{i - 1, l - d, r + d});
+	    pila.push_back(Tramo{i + 1, l - d, r + d});
+
+	    j = r;
+	}
+    }
+
+    return res;
+}
+
+
+/// Igual que crece_region, pero la semilla (y la imagen) la indica un
+/// iterador 2D.
+template <typename Img, typename Pred, typename Accion>
+inline Componente crece_region(const Iterator2D_t<Img>& semilla,
+			       Pred pertenece, Accion accion,
+			       Conectividad con = Conectividad::cuatro)
+{ 
+    return crece_region(std::as_const(semilla.imagen()), semilla.posicion(),
+			pertenece, accion, con); 
+}
+
+
+
+/// Rellena con 'color' la región de pixeles del mismo color que 'semilla'
+/// (el "bote de pintura" de los programas de dibujo).
+/// Devuelve el número de pixeles pintados y el rectángulo que los
+/// contiene.
+///
+/// Img = Image o Subimage (sus filas son contiguas en memoria).
+template <typename Img>
+Componente rellena(Img& img0, Position semilla, const ColorRGB& color,
+		   Conectividad con = Conectividad::cuatro)
+{
+    ColorRGB color0 = img0(semilla.i, semilla.j);
+
+    return crece_region(img0, semilla,
+	    [color0](const ColorRGB& c){ return c == color0; },
+	    [&img0, color](Ind i, Ind j0, Ind je){
+		ColorRGB* p = &img0(i, j0);
+		std::fill(p, p + (je - j0), color);
+	    }, con);
+}
+
+
+}// namespace img
+
+#endif
+
@@ -0,0 +1,254 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Núcleos para calcular los gradientes.
+ *
+ *   - COMENTARIOS: Todos los núcleos operan sobre una fila, recibiendo
+ *	punteros a la fila anterior (a), la actual (b) y la siguiente (c).
+ *	Los bordes (j = 0, j = cols - 1) se calculan aparte; así el bucle
+ *	interior no tiene ningún if y el compilador lo puede vectorizar.
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include "img_gradient.h"
+#include "img_parallel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace img{
+
+// Pesos del suavizado (w0, w1, w0) en la dirección perpendicular a la
+// derivada.
+struct Pesos{
+    int w0, w1;
+};
+
+static Pesos pesos(Tipo_gradiente tipo)
+{
+    switch(tipo){
+	break; case Tipo_gradiente::sobel : return Pesos{1, 2};
+	break; case Tipo_gradiente::scharr: return Pesos{3, 10};
+	break; default			  : return Pesos{0, 1};
+    }
+}
+
+
+// Fila i del plano con los bordes repetidos: fila(-1) = fila(0)...
+static const int* fila(const Plane<int>& img0, Ind i)
+{
+    i = std::clamp(i, Ind{0}, img0.rows() - 1);
+    return &img0(i, 0);
+}
+
+
+// d[j] = w0*(a[j+1]-a[j-1]) + w1*(b[j+1]-b[j-1]) + w0*(c[j+1]-c[j-1])
+static void nucleo_x(const int* a, const int* b, const int* c, int* d,
+		     Ind n, Pesos w)
+{
+    auto en = [=](Ind jp, Ind jn){
+	return w.w0 * (a[jn] - a[jp]) + w.w1 * (b[jn] - b[jp])
+	     + w.w0 * (c[jn] - c[jp]);
+    };
+
+    if (n == 1){
+	d[0] = 0;
+	return;
+    }
+
+    d[0] = en(0, 1);
+
+    if (w.w0 == 0){ // centrales
+	for (Ind j = 1; j < n - 1; ++j)
+	    d[j] = b[j + 1] - b[j - 1];
+    }
+    else{
+	for (Ind j = 1; j < n - 1; ++j)
+	    d[j] = w.w0 * (a[j + 1] - a[j - 1]) + w.w1 * (b[j + 1] - b[j - 1])
+		 + w.w0 * (c[j + 1] - c[j - 1]);
+    }
+
+    d[n - 1] = en(n - 2, n - 1);
+}
+
+
+// d[j] = w0*(c[j-1]-a[j-1]) + w1*(c[j]-a[j]) + w0*(c[j+1]-a[j+1])
+static void nucleo_y(const int* a, const int* c, int* d, Ind n, Pesos w)
+{
+    auto en = [=](Ind jp, Ind j, Ind jn){
+	return w.w0 * (c[jp] - a[jp]) + w.w1 * (c[j] - a[j])
+	     + w.w0 * (c[jn] - a[jn]);
+    };
+
+    if (n == 1){
+	d[0] = w.w1 * (c[0] - a[0]) + 2 * w.w0 * (c[0] - a[0]);
+	return;
+    }
+
+    d[0] = en(0, 0, 1);
+
+    if (w.w0 == 0){ // centrales
+	for (Ind j = 1; j < n - 1; ++j)
+	    d[j] = c[j] - a[j];
+    }
+    else{
+	for (Ind j = 1; j < n - 1; ++j)
+	    d[j] = w.w0 * (c[j - 1] - a[j - 1]) + w.w1 * (c[j] - a[j])
+		 + w.w0 * (c[j + 1] - a[j + 1]);
+    }
+
+    d[n - 1] = en(n - 2, n - 1, n - 1);
+}
+
+
+Plane<int> gradiente_x(const Plane<int>& img0, Tipo_gradiente tipo)
+{
+    Ind rows = img0.rows();
+    Ind cols = img0.cols();
+    Plane<int> res{rows, cols};
+
+    if (rows == 0 or cols == 0)
+	return res;
+
+    Pesos w = pesos(tipo);
+
+    parallel_for(rows, [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i){
+	    int* d = &res(i, 0);
+
+	    if (tipo == Tipo_gradiente::diferencias){
+		const int* b = &img0(i, 0);
+		d[0] = 0;
+		for (Ind j = 1; j < cols; ++j)
+		    d[j] = b[j] - b[j - 1];
+	    }
+	    else
+		nucleo_x(fila(img0, i - 1), fila(img0, i), fila(img0, i + 1),
+			 d, cols, w);
+	}
+    }, cols);
+
+    return res;
+}
+
+
+Plane<int> gradiente_y(const Plane<int>& img0, Tipo_gradiente tipo)
+{
+    Ind rows = img0.rows();
+    Ind cols = img0.cols();
+    Plane<int> res{rows, cols};
+
+    if (rows == 0 or cols == 0)
+	return res;
+
+    Pesos w = pesos(tipo);
+
+    parallel_for(rows, [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i){
+	    int* d = &res(i, 0);
+
+	    if (tipo == Tipo_gradiente::diferencias){
+		const int* a = fila(img0, i - 1);
+		const int* b = &img0(i, 0);
+		for (Ind j = 0; j < cols; ++j)
+		    d[j] = b[j] - a[j];
+	    }
+	    else
+		nucleo_y(fila(img0, i - 1), fila(img0, i + 1), d, cols, w);
+	}
+    }, cols);
+
+    return res;
+}
+
+
+Plane<float> magnitud(const Plane<int>& gx, const Plane<int>& gy)
+{
+    Plane<float> res{gx.rows(), gx.cols()};
+    Ind cols = gx.cols();
+
+    parallel_for(gx.rows(), [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i){
+	    const int* x = &gx(i, 0);
+	    const int* y = &gy(i, 0);
+	    float* d = &res(i, 0);
+
+	    for (Ind j = 0; j < cols; ++j){
+		float fx = static_cast<float>(x[j]);
+		float fy = static_cast<float>(y[j]);
+		d[j] = std::sqrt(fx*fx + fy*fy);
+	    }
+	}
+    }, cols);
+
+    return res;
+}
+
+
+Plane<int> magnitud_L1(const Plane<int>& gx, const Plane<int>& gy)
+{
+    Plane<int> res{gx.rows(), gx.cols()};
+    Ind cols = gx.cols();
+
+    parallel_for(gx.rows(), [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i){
+	    const int* x = &gx(i, 0);
+	    const int* y = &gy(i, 0);
+	    int* d = &res(i, 0);
+
+	    for (Ind j = 0; j < cols; ++j)
+		d[j] = std::abs(x[j]) + std::abs(y[j]);
+	}
+    }, cols);
+
+    return res;
+}
+
+
+Plane<float> orientacion(const Plane<int>& gx, const Plane<int>& gy)
+{
+    constexpr float grados = 180.0f / 3.14159265358979323846f;
+
+    Plane<float> res{gx.rows(), gx.cols()};
+    Ind cols = gx.cols();
+
+    parallel_for(gx.rows(), [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i){
+	    const int* x = &gx(i, 0);
+	    const int* y = &gy(i, 0);
+	    float* d = &res(i, 0);
+
+	    // la y crece hacia abajo: cambiamos de signo
+	    for (Ind j = 0; j < cols; ++j)
+		d[j] = grados * std::atan2(static_cast<float>(-y[j]),
+					   static_cast<float>(x[j]));
+	}
+    }, cols);
+
+    return res;
+}
+
+
+}// namespace img
+
@@ -0,0 +1,156 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#ifndef __IMG_GRADIENT_H__
+#define __IMG_GRADIENT_H__
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Gradientes de una imagen completa.
+ *
+ *   - COMENTARIOS: It_diferencias_x calcula las diferencias primeras
+ *	elemento a elemento. Aquí calculamos el gradiente de toda la imagen
+ *	de golpe, fila a fila, repartiendo las filas entre varios hilos.
+ *
+ *	Los gradientes se calculan sobre un canal (un Plane<int>). Si se
+ *	pasa cualquier otro contenedor bidimensional (imagen_red(img),
+ *	...) primero se copia a un Plane<int>, de esa forma los núcleos
+ *	trabajan siempre sobre filas contiguas y el compilador los puede
+ *	vectorizar.
+ *
+ *	    auto [gx, gy] = gradiente(imagen_red(img), Tipo_gradiente::sobel);
+ *	    auto mod = magnitud(gx, gy);
+ *
+ *	Ejes: x = dirección de las columnas (j creciente, hacia la dcha),
+ *	      y = dirección de las filas (i creciente, hacia abajo).
+ *	En los bordes se repite el pixel del borde.
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include "img_image.h"
+#include "img_view.h"	// Filas_con_salto
+
+namespace img{
+
+/// Tipos de gradientes que sabemos calcular.
+///
+///	diferencias: gx(i,j) = x(i,j) - x(i,j-1) (igual que It_diferencias_x)
+///	centrales  : gx(i,j) = x(i,j+1) - x(i,j-1)
+///	sobel	   : centrales suavizadas con (1, 2, 1) en la otra dirección
+///	scharr	   : centrales suavizadas con (3, 10, 3) en la otra dirección
+///
+/// No se normaliza el resultado (para no perder precisión al trabajar
+/// con enteros).
+enum class Tipo_gradiente {diferencias, centrales, sobel, scharr};
+
+
+/// Gradientes de una imagen en las direcciones x e y.
+struct Gradientes{
+    Plane<int> x;
+    Plane<int> y;
+};
+
+
+/// Copia el contenedor bidimensional img0 a un plano de enteros.
+template <typename Img>
+Plane<int> plano_int(const Img& img0)
+{
+    Plane<int> res{img0.rows(), img0.cols()};
+
+    if (img0.cols() == 0)
+	return res;
+
+    for (Ind i = 0; i < img0.rows(); ++i){
+	int* p = &res(i, 0);
+
+	if constexpr (Filas_con_salto<const Img>)
+	    para_cada(fila_con_salto(img0, i), [&p](const auto& x)
+						    { *p++ = x; });
+	else
+	    for (Ind j = 0; j < img0.cols(); ++j)
+		p[j] = img0(i, j);
+    }
+
+    return res;
+}
+
+
+/// Gradiente en la dirección x de img0.
+Plane<int> gradiente_x(const Plane<int>& img0,
+			Tipo_gradiente tipo = Tipo_gradiente::sobel);
+
+/// Gradiente en la dirección y de img0.
+Plane<int> gradiente_y(const Plane<int>& img0,
+			Tipo_gradiente tipo = Tipo_gradiente::sobel);
+
+/// Gradientes en las direcciones x e y de img0.
+inline Gradientes gradiente(const Plane<int>& img0,
+			    Tipo_gradiente tipo = Tipo_gradiente::sobel)
+{ return Gradientes{gradiente_x(img0, tipo), gradiente_y(img0, tipo)}; }
+
+
+// Img = cualquier contenedor bidimensional de números
+template <typename Img>
+inline Plane<int> gradiente_x(const Img& img0,
+			      Tipo_gradiente tipo = Tipo_gradiente::sobel)
+{ return gradiente_x(plano_int(img0), tipo); }
+
+template <typename Img>
+inline Plane<int> gradiente_y(const Img& img0,
+			      Tipo_gradiente tipo = Tipo_gradiente::sobel)
+{ return gradiente_y(plano_int(img0), tipo); }
+
+template <typename Img>
+inline Gradientes gradiente(const Img& img0,
+			    Tipo_gradiente tipo = Tipo_gradiente::sobel)
+{ return gradiente(plano_int(img0), tipo); }
+
+
+
+/// Módulo del gradiente: sqrt(gx^2 + gy^2).
+/// Precondición: gx y gy tienen las mismas dimensiones.
+Plane<float> magnitud(const Plane<int>& gx, const Plane<int>& gy);
+
+/// Norma L1 del gradiente: |gx| + |gy|. Más rápida que magnitud y
+/// suficiente para la mayoría de las aplicaciones (energía de una costura,
+/// umbrales para detectar bordes...).
+Plane<int> magnitud_L1(const Plane<int>& gx, const Plane<int>& gy);
+
+/// Orientación del gradiente, en grados, en (-180, 180].
+/// El ángulo se mide como se mide matemáticamente: el eje y va hacia
+/// arriba (al revés que la i), igual que en Vector_direccion.
+Plane<float> orientacion(const Plane<int>& gx, const Plane<int>& gy);
+
+
+inline Plane<float> magnitud(const Gradientes& g)
+{ return magnitud(g.x, g.y); }
+
+inline Plane<int> magnitud_L1(const Gradientes& g)
+{ return magnitud_L1(g.x, g.y); }
+
+inline Plane<float> orientacion(const Gradientes& g)
+{ return orientacion(g.x, g.y); }
+
+}// namespace img
+
+#endif
+
@@ -38,11 +38,23 @@
  *	    auto g = grid(img, m, n);	// crea const (o no) si img es const
  *					// (o no)
  *
+ *	+ Estadísticas de las celdas del grid:
+ *	  ------------------------------------
+ *	    auto st = estadisticas(g, Color_red{});  // una por celda
+ *	    st(i, j).media(); st(i, j).varianza(); st(i, j).max; ...
+ *
  *   - HISTORIA:
  *           alp  - 05/07/2016 Escrito
+ *	Manuel Perez - 19/10/2026 estadisticas
  *
  ****************************************************************************/
+#include <cstdint>
+#include <limits>
+
+#include <alp_matrix.h>
+
 #include "img_view.h"
+#include "img_parallel.h"
 
 namespace img{
 
@@ -122,6 +134,10 @@ public:
     size_type rows_por_pixel() const {return m;}
     size_type cols_por_pixel() const {return n;}
 
+    /// Contenedor sobre el que hemos colocado el grid.
+    ContenedorB& contenedor() {return *c;}
+    const ContenedorB& contenedor() const {return *c;}
+
     // (i, j) = índices de la región
     alp::Submatriz<ContenedorB> operator()(size_type i, size_type j)
 	{return alp::Submatriz<ContenedorB>{*c, I(i),J(j), m, n};}
@@ -170,6 +186,140 @@ Grid<const ContenedorB> grid(const ContenedorB& c, int m, int n)
 {return Grid<const ContenedorB>{c, m, n};}
 
 
+/*****************************************************************************
+ * 
+ *   - CLASE: Estadisticas
+ *
+ *   - DESCRIPCIÓN: Estadísticas básicas (media, min, max, varianza) de un
+ *	conjunto de enteros. Se van añadiendo los valores de uno en uno.
+ *
+ ***************************************************************************/
+struct Estadisticas{
+    using Suma = std::int64_t;
+
+    Suma n     = 0;	// número de valores
+    Suma suma  = 0;	// suma de los valores
+    Suma suma2 = 0;	// suma de sus cuadrados
+    int min = std::numeric_limits<int>::max();
+    int max = std::numeric_limits<int>::min();
+
+    void add(int x)
+    {
+	++n;
+	suma  += x;
+	suma2 += static_cast<Suma>(x) * x;
+	if (x < min) min = x;
+	if (x > max) max = x;
+    }
+
+    // Precondición: n > 0
+    double media() const 
+    { return static_cast<double>(suma) / static_cast<double>(n); }
+
+    /// Varianza de la población.
+    double varianza() const
+    {
+	double m = media();
+	double v = static_cast<double>(suma2) / static_cast<double>(n) - m*m;
+	return (v < 0.0? 0.0: v);
+    }
+};
+
+
+/// Estadísticas de cada uno de los canales de un ColorRGB.
+struct EstadisticasRGB{
+    Estadisticas r, g, b;
+
+    void add(const ColorRGB& c)
+    {
+	r.add(c.r);
+	g.add(c.g);
+	b.add(c.b);
+    }
+
+    /// Color medio (truncado, como ColorRGB::operator/)
+    ColorRGB media() const
+    {
+	return ColorRGB{static_cast<int>(r.suma / r.n),
+			static_cast<int>(g.suma / g.n),
+			static_cast<int>(b.suma / b.n)};
+    }
+};
+
+
+/// Calcula las estadísticas de cada una de las celdas del grid.
+/// Devuelve una matriz de g.rows() x g.cols(), con las estadísticas de
+/// proy(x) para los x de cada celda.
+///
+/// En lugar de recorrer cada celda por separado recorremos el contenedor
+/// una sola vez, por filas, acumulando en la celda correspondiente. Las
+/// filas de celdas se reparten entre varios hilos.
+///
+/// Ejemplo: auto st = estadisticas(grid(img, 16, 16), Color_red{});
+template <typename ContenedorB, typename Proyeccion>
+alp::Matrix<Estadisticas, Ind> 
+    estadisticas(const Grid<ContenedorB>& g, Proyeccion proy)
+{
+    alp::Matrix<Estadisticas, Ind> res{g.rows(), g.cols()};
+    std::fill(res.begin(), res.end(), Estadisticas{});
+
+    auto& img0 = g.contenedor();
+    Ind m  = g.rows_por_pixel();
+    Ind n  = g.cols_por_pixel();
+    Ind nc = g.cols();
+
+    parallel_for(g.rows(), [&](Ind I0, Ind Ie){
+	for (Ind I = I0; I < Ie; ++I){
+	    Estadisticas* celdas = &res(I, 0);
+
+	    for (Ind i = I*m; i < (I + 1)*m; ++i){
+		Ind j = 0;
+		for (Ind J = 0; J < nc; ++J){
+		    Estadisticas& st = celdas[J];
+		    for (Ind je = j + n; j < je; ++j)
+			st.add(proy(img0(i, j)));
+		}
+	    }
+	}
+    }, m * n * nc);
+
+    return res;
+}
+
+
+/// Calcula las estadísticas de cada canal de cada celda del grid.
+/// Igual que estadisticas, pero en una sola pasada para los 3 canales.
+template <typename ContenedorB>
+alp::Matrix<EstadisticasRGB, Ind> 
+    estadisticasRGB(const Grid<ContenedorB>& g)
+{
+    alp::Matrix<EstadisticasRGB, Ind> res{g.rows(), g.cols()};
+    std::fill(res.begin(), res.end(), EstadisticasRGB{});
+
+    auto& img0 = g.contenedor();
+    Ind m  = g.rows_por_pixel();
+    Ind n  = g.cols_por_pixel();
+    Ind nc = g.cols();
+
+    parallel_for(g.rows(), [&](Ind I0, Ind Ie){
+	for (Ind I = I0; I < Ie; ++I){
+	    EstadisticasRGB* celdas = &res(I, 0);
+
+	    for (Ind i = I*m; i < (I + 1)*m; ++i){
+		Ind j = 0;
+		for (Ind J = 0; J < nc; ++J){
+		    EstadisticasRGB& st = celdas[J];
+		    for (Ind je = j + n; j < je; ++j)
+			st.add(img0(i, j));
+		}
+	    }
+	}
+    }, m * n * nc);
+
+    return res;
+}
+
+
 /*****************************************************************************
  * 
  *   - CLASE: Grid_d
@@ -28,6 +28,7 @@
  *			       Añado iteradores bidimensionales.
  *		    19/11/2017 Añado Image_xy.
  *		    31/03/2019 Convierto Image en Matrix<ColorRGB>
+ *		    19/10/2026 Plane
  *
  ****************************************************************************/
 #include <iostream>
@@ -62,6 +63,12 @@ using Range2D  = alp::Matrix<ColorRGB, Ind>::Range2D;
 
 using Range2D_acotado = alp::Range_acotado_ij<Ind>;
 
+/// Imagen de un solo canal (un plano) cuyos elementos son de tipo T.
+/// Los algoritmos numéricos (gradientes, ...) trabajan sobre planos ya que
+/// sus filas son contiguas en memoria.
+template <typename T>
+using Plane = alp::Matrix<T, Ind>;
+
 
 /// Indica si una posición pertenece a una imagen o no
 inline bool belongs(Position p, const Image& img)
@@ -80,8 +87,20 @@ inline Position posicion_del_centro(const Image& img)
 Image read(const std::string& name);
 
 /// Escribe la imagen en el fichero 'name'.
+/// precondición: todos los pixeles están en el cubo de color (si no,
+/// lanza una excepción).
 void write(const Image& img, const std::string& name);
 
+/// ¿Qué hacer al escribir un pixel que se sale del cubo de color?
+enum class Fuera_de_rango{
+    error,  // lanza una excepción
+    satura  // recorta cada canal a [0, 255]
+};
+
+/// Escribe la imagen en el fichero 'name'. Con Fuera_de_rango::satura no
+/// hace falta llamar antes a satura(img): recorta los canales al copiarlos.
+void write(const Image& img, const std::string& name, Fuera_de_rango modo);
+
 
 } //namespace img
 
@@ -0,0 +1,354 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#ifndef __IMG_INTEGRAL_H__
+#define __IMG_INTEGRAL_H__
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Imagen integral (summed-area table).
+ *
+ *   - COMENTARIOS: La imagen integral S de una imagen x es
+ *
+ *		S(i, j) = suma de x(k, l) con k < i, l < j
+ *
+ *	Una vez calculada, la suma de cualquier rectángulo de la imagen se
+ *	obtiene con 4 accesos a S, independientemente del tamaño del
+ *	rectángulo.
+ *
+ *	    Integral_image S{const_imagen_red(img), true};
+ *	    auto m = S.media(Position{10, 10}, Size2D{20, 30});
+ *	    auto v = S.varianza(Position{10, 10}, Size2D{20, 30});
+ *
+ *	Para calcular la varianza hay que indicar en el constructor que
+ *	queremos guardar también la suma de los cuadrados.
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include <cstdint>
+#include <stdexcept>
+
+#include <alp_matrix.h>
+
+#include "img_image.h"
+#include "img_color.h"
+#include "img_view.h"
+#include "img_draw.h"	    // Rectangulo
+#include "img_parallel.h"
+
+namespace img{
+
+/*!
+ *  \brief  Imagen integral de una imagen de un solo canal.
+ *
+ *  Img puede ser cualquier contenedor bidimensional cuyos elementos sean
+ *  números: un canal de una imagen (imagen_red, ...), una Subimage vista
+ *  a través de imagen_view, ...
+ *
+ *  Los rectángulos que se pasan a las funciones de consulta son cerrados:
+ *  incluyen las dos esquinas. Precondición: tienen que estar dentro de la
+ *  imagen.
+ */
+class Integral_image{
+public:
+    using Suma = std::int64_t;	// 255^2 * 2^24 < 2^63: no hay overflow
+
+    /// Calcula la imagen integral de img0. Si con_cuadrados == true
+    /// calcula también la de img0^2 (necesaria para calcular varianzas).
+    template <typename Img>
+    explicit Integral_image(const Img& img0, bool con_cuadrados = false);
+
+    /// Calcula la imagen integral de proy(img0(i,j)).
+    /// Ejemplo: Integral_image S{img, Color_red{}};
+    template <typename Img, typename Proyeccion>
+    Integral_image(const Img& img0, Proyeccion proy, bool con_cuadrados = false);
+
+    /// Dimensiones de la imagen original.
+    Ind rows() const {return S_.rows() - 1;}
+    Ind cols() const {return S_.cols() - 1;}
+
+    /// ¿Se ha calculado la suma de los cuadrados?
+    bool con_cuadrados() const {return S2_.rows() != 0;}
+
+
+    // Suma
+    // ----
+    /// Suma de los elementos del rectángulo [p0, pe] (incluye pe).
+    Suma suma(const Position& p0, const Position& pe) const
+    { return suma(S_, p0, pe); }
+
+    /// Suma de los elementos del rectángulo de esquina p0 y tamaño sz.
+    Suma suma(const Position& p0, const Size2D& sz) const
+    { return suma(p0, esquina(p0, sz)); }
+
+    Suma suma(const Rectangulo& r) const
+    { return suma(r.upper_left_corner(), r.bottom_right_corner()); }
+
+
+    // Suma de cuadrados
+    // -----------------
+    // Precondición: con_cuadrados()
+    Suma suma_cuadrados(const Position& p0, const Position& pe) const
+    { return suma(S2_, p0, pe); }
+
+    Suma suma_cuadrados(const Position& p0, const Size2D& sz) const
+    { return suma_cuadrados(p0, esquina(p0, sz)); }
+
+    Suma suma_cuadrados(const Rectangulo& r) const
+    { return suma_cuadrados(r.upper_left_corner(), r.bottom_right_corner()); }
+
+
+    // Media
+    // -----
+    double media(const Position& p0, const Position& pe) const
+    { return static_cast<double>(suma(p0, pe)) / area(p0, pe); }
+
+    double media(const Position& p0, const Size2D& sz) const
+    { return media(p0, esquina(p0, sz)); }
+
+    double media(const Rectangulo& r) const
+    { return media(r.upper_left_corner(), r.bottom_right_corner()); }
+
+
+    // Varianza
+    // --------
+    /// Varianza (de la población) de los elementos de [p0, pe].
+    /// Precondición: con_cuadrados()
+    double varianza(const Position& p0, const Position& pe) const;
+
+    double varianza(const Position& p0, const Size2D& sz) const
+    { return varianza(p0, esquina(p0, sz)); }
+
+    double varianza(const Rectangulo& r) const
+    { return varianza(r.upper_left_corner(), r.bottom_right_corner()); }
+
+
+    /// Número de elementos del rectángulo [p0, pe].
+    static Suma area(const Position& p0, const Position& pe)
+    { return static_cast<Suma>(pe.i - p0.i + 1) * (pe.j - p0.j + 1); }
+
+private:
+    using Tabla = alp::Matrix<Suma, Ind>;
+
+    Tabla S_;	// (rows + 1) x (cols + 1). La fila y columna 0 son 0.
+    Tabla S2_;	// igual que S_ pero de los cuadrados (o vacía)
+
+    // Funciones de ayuda
+    template <typename Img, typename Proyeccion>
+    void calcula(const Img& img0, Proyeccion proy);
+
+    static void acumula_columnas(Tabla& S);
+
+    static Suma suma(const Tabla& S, const Position& p0, const Position& pe)
+    {
+	return S(pe.i + 1, pe.j + 1) - S(p0.i, pe.j + 1)
+	     - S(pe.i + 1, p0.j)     + S(p0.i, p0.j);
+    }
+
+    static Position esquina(const Position& p0, const Size2D& sz)
+    { return Position{p0.i + sz.rows - 1, p0.j + sz.cols - 1}; }
+};
+
+
+namespace impl_of{
+struct Identidad{
+    template <typename T>
+    const T& operator()(const T& x) const {return x;}
+};
+}// namespace impl_of
+
+
+template <typename Img>
+inline Integral_image::Integral_image(const Img& img0, bool con_cuadrados)
+    : Integral_image{img0, impl_of::Identidad{}, con_cuadrados}
+{ }
+
+
+template <typename Img, typename Proyeccion>
+Integral_image::Integral_image(const Img& img0, Proyeccion proy,
+							bool con_cuadrados)
+    : S_{img0.rows() + 1, img0.cols() + 1},
+      S2_{con_cuadrados? img0.rows() + 1: 0,
+	  con_cuadrados? img0.cols() + 1: 0}
+{
+    calcula(img0, proy);
+}
+
+
+// Lo calculamos en dos pasadas:
+//  1. Cada fila, de forma independiente, se reemplaza por sus sumas
+//     parciales. Se reparten las filas entre los hilos.
+//  2. Se acumulan las filas de arriba a abajo. Se reparten las columnas
+//     entre los hilos, de esa forma cada hilo recorre la tabla por filas
+//     (y el bucle interno es vectorizable).
+template <typename Img, typename Proyeccion>
+void Integral_image::calcula(const Img& img0, Proyeccion proy)
+{
+    Ind nrows = img0.rows();
+    Ind ncols = img0.cols();
+    bool cuadrados = con_cuadrados();
+
+    // fila 0 a cero
+    for (Ind j = 0; j <= ncols; ++j)
+	S_(0, j) = 0;
+
+    if (cuadrados)
+	for (Ind j = 0; j <= ncols; ++j)
+	    S2_(0, j) = 0;
+
+    parallel_for(nrows, [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i){
+	    Suma* s  = &S_(i + 1, 0);
+	    Suma acc = 0;
+	    s[0] = 0;
+
+	    if (cuadrados){
+		Suma* s2  = &S2_(i + 1, 0);
+		Suma acc2 = 0;
+		s2[0] = 0;
+
+		auto suma = [&](Ind j, Suma x){
+		    acc  += x;
+		    acc2 += x*x;
+		    s[j + 1]  = acc;
+		    s2[j + 1] = acc2;
+		};
+
+		if constexpr (Filas_con_salto<const Img>){
+		    Ind j = 0;
+		    para_cada(fila_con_salto(img0, i), [&](const auto& x)
+						    { suma(j++, proy(x)); });
+		}
+		else
+		    for (Ind j = 0; j < ncols; ++j)
+			suma(j, proy(img0(i, j)));
+	    }
+
+	    else{
+		if constexpr (Filas_con_salto<const Img>){
+		    Suma* q = s + 1;
+		    para_cada(fila_con_salto(img0, i), [&](const auto& x)
+					    { acc += proy(x); *q++ = acc; });
+		}
+		else
+		    for (Ind j = 0; j < ncols; ++j){
+			acc += proy(img0(i, j));
+			s[j + 1] = acc;
+		    }
+	    }
+	}
+    }, ncols);
+
+    acumula_columnas(S_);
+
+    if (cuadrados)
+	acumula_columnas(S2_);
+}
+
+
+inline void Integral_image::acumula_columnas(Tabla& S)
+{
+    Ind nrows = S.rows();
+    Ind ncols = S.cols();
+
+    parallel_for(ncols, [&](Ind j0, Ind je){
+	for (Ind i = 1; i < nrows; ++i){
+	    const Suma* a = &S(i - 1, 0);
+	    Suma* s = &S(i, 0);
+
+	    for (Ind j = j0; j < je; ++j)
+		s[j] += a[j];
+	}
+    }, nrows);
+}
+
+
+inline double Integral_image::varianza(const Position& p0,
+				       const Position& pe) const
+{
+    if (!con_cuadrados())
+	throw std::logic_error{"Integral_image::varianza: no se ha calculado "
+			       "la suma de los cuadrados"};
+
+    double n  = static_cast<double>(area(p0, pe));
+    double m  = static_cast<double>(suma(p0, pe)) / n;
+    double m2 = static_cast<double>(suma_cuadrados(p0, pe)) / n;
+
+    double v = m2 - m*m;
+
+    return (v < 0.0? 0.0: v); // por errores de redondeo
+}
+
+
+
+/*!
+ *  \brief  Imagen integral de una imagen en color.
+ *
+ *  Guarda una imagen integral por cada canal.
+ *
+ *	Integral_imageRGB S{img};
+ *	ColorRGB c = S.media(r);    // color medio del rectángulo r
+ *
+ */
+class Integral_imageRGB{
+public:
+    /// Img = Image, Subimage, const_Subimage...
+    template <typename Img>
+    explicit Integral_imageRGB(const Img& img0, bool con_cuadrados = false)
+	: red_  {img0, const_Color_red{}, con_cuadrados},
+	  green_{img0, const_Color_green{}, con_cuadrados},
+	  blue_ {img0, const_Color_blue{}, con_cuadrados}
+    { }
+
+    Ind rows() const {return red_.rows();}
+    Ind cols() const {return red_.cols();}
+
+    // Acceso a cada uno de los canales
+    const Integral_image& red() const {return red_;}
+    const Integral_image& green() const {return green_;}
+    const Integral_image& blue() const {return blue_;}
+
+    /// Color medio del rectángulo [p0, pe]. Como ColorRGB es entero
+    /// se trunca (igual que ColorRGB::operator/).
+    ColorRGB media(const Position& p0, const Position& pe) const
+    {
+	auto n = Integral_image::area(p0, pe);
+	return ColorRGB{static_cast<int>(red_.suma(p0, pe) / n),
+			static_cast<int>(green_.suma(p0, pe) / n),
+			static_cast<int>(blue_.suma(p0, pe) / n)};
+    }
+
+    ColorRGB media(const Position& p0, const Size2D& sz) const
+    { return media(p0, Position{p0.i + sz.rows - 1, p0.j + sz.cols - 1}); }
+
+    ColorRGB media(const Rectangulo& r) const
+    { return media(r.upper_left_corner(), r.bottom_right_corner()); }
+
+private:
+    Integral_image red_, green_, blue_;
+};
+
+
+}// namespace img
+
+#endif
+
@@ -28,6 +28,7 @@
  *
  *   - HISTORIA:
  *           alp  - 26/08/2017 Escrito
+ *	Manuel Perez - 19/10/2026 Vector_direccion gira usando tablas.
  *
  ****************************************************************************/
 #include "img_image.h"
@@ -108,14 +109,19 @@ private:
 		    // direcciones. En el algoritmo de la muralla es lo que
 		    // voy a hacer todo el rato. Quiero que sea eficiente el
 		    // giro!!!
+
+    // (x, y) de cada dirección, en el orden en que están definidas en
+    // Direccion: girar 45 grados en sentido positivo es sumar 1 (módulo 8).
+    static constexpr int tabla_x_[8] = {1, 1, 0, -1, -1, -1,  0,  1};
+    static constexpr int tabla_y_[8] = {0, 1, 1,  1,  0, -1, -1, -1};
     
     // Funciones de ayuda
     // Definimos una nueva dirección.
     // Precondición: x, y solo puede valer -1, 0 ó 1.
     constexpr Vector_direccion(int x, int y, Direccion d);
 
-    void gira_45_sentido_mas();
-    void gira_45_sentido_menos();
+    // Gira n veces 45 grados en sentido positivo.
+    void gira(int n);
 
 };
 
@@ -151,28 +157,24 @@ inline constexpr Vector_direccion::Vector_direccion(int x, int y, Direccion d)
 
 
 
-// Gira la dirección 45 grados en sentido horario o antihorario.
-inline void Vector_direccion::gira_45(bool sentido_positivo)
+inline void Vector_direccion::gira(int n)
 {
-    if (sentido_positivo)
-	gira_45_sentido_mas();
-    else
-	gira_45_sentido_menos();
+    int d = (static_cast<int>(direccion_) + n) & 7;
+
+    direccion_ = static_cast<Direccion>(d);
+    x_ = tabla_x_[d];
+    y_ = tabla_y_[d];
 }
 
 
+// Gira la dirección 45 grados en sentido horario o antihorario.
+inline void Vector_direccion::gira_45(bool sentido_positivo)
+{ gira(sentido_positivo? 1: 7); }
+
+
 // Gira la dirección 90 grados en sentido horario o antihorario.
 inline void Vector_direccion::gira_90(bool sentido_positivo)
-{
-    // TODO: si se ve que uso esto, escribir gira_90_sentido_mas/menos.
-    // Son más eficientes que llamar 2 veces a gira_45.
-    gira_45(sentido_positivo);
-    gira_45(sentido_positivo);
-//    if (sentido_positivo)
-//	gira_90_sentido_mas();
-//    else
-//	gira_90_sentido_menos();
-}
+{ gira(sentido_positivo? 2: 6); }
 
 
 
@@ -221,6 +223,10 @@ inline std::ostream& operator<<(std::ostream& out, const Direccion& d)
  *  Observad que al usar estos iteradores se necesitará un mapa para saber qué
  *  zonas de la imagen ya hemos recorrido o no.
  *
+ *  Sobre una Image_con_borde (img_padded.h) el iterador se puede salir hasta
+ *  k pixeles de la imagen y seguir dereferenciándose: no hace falta
+ *  comprobar puedo_ir_*() antes de mirar los vecinos.
+ *
  */
 template <typename Img>
 class Iterator2D_t{
@@ -276,6 +282,9 @@ public:
     /// Posición que apuntamos en la imagen
     Position posicion() const {return p_;}
 
+    /// Imagen por la que nos movemos
+    Img& imagen() const {return *img_;}
+
 
     Color_t& operator*() const {return (*img_)(p_);}
     Color_t* operator->() const {return &*(*this);}
@@ -297,9 +306,7 @@ public:
     /// Indica si el iterador puede moverse en la dirección d 
     bool puedo_moverme(const Vector_direccion& d)
     {
-	auto p = *this;
-	p.muevete(d);
-	return p.esta_dentro();
+	return pertenece(Position{p_.i - d.y(), p_.j + d.x()}, *img_);
     }
 
 private:
@@ -0,0 +1,116 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "img_lut.h"
+
+namespace img{
+
+LUT::LUT()
+{
+    for (int x = 0; x < N; ++x)
+	t_[x] = static_cast<std::uint8_t>(x);
+}
+
+
+LUT LUT::brillo(int delta)
+{ return desde([delta](int x){return x + delta;}); }
+
+
+LUT LUT::contraste(double k, int centro)
+{ return desde([k, centro](int x){return centro + (x - centro) * k;}); }
+
+
+LUT LUT::gamma(double g)
+{
+    if (!(g > 0))
+	throw std::logic_error{"LUT::gamma: la gamma tiene que ser positiva"};
+
+    constexpr double cmax = max_color;
+    return desde([g](int x){
+	return cmax * std::pow(x / cmax, 1.0 / g);
+    });
+}
+
+
+LUT LUT::niveles(int negro, int blanco, double g,
+		 int salida_negro, int salida_blanco)
+{
+    if (!(g > 0))
+	throw std::logic_error{"LUT::niveles: la gamma tiene que ser positiva"};
+
+    return desde([=](int x){
+	if (blanco <= negro)	// tabla escalón
+	    return static_cast<double>(x < blanco? salida_negro: salida_blanco);
+
+	double t = std::clamp((x - negro) / static_cast<double>(blanco - negro),
+								    0.0, 1.0);
+	t = std::pow(t, 1.0 / g);
+
+	return salida_negro + t * (salida_blanco - salida_negro);
+    });
+}
+
+
+LUT LUT::curva(std::span<const std::pair<int, int>> ps)
+{
+    return desde([ps](int x){
+	if (x <= ps.front().first)
+	    return static_cast<double>(ps.front().second);
+
+	if (x >= ps.back().first)
+	    return static_cast<double>(ps.back().second);
+
+	// ps[k].first < x <= ps[k+1].first
+	size_t k = 0;
+	while (ps[k + 1].first < x)
+	    ++k;
+
+	auto [x0, y0] = ps[k];
+	auto [x1, y1] = ps[k + 1];
+
+	return y0 + (y1 - y0) * static_cast<double>(x - x0) / (x1 - x0);
+    });
+}
+
+
+LUT LUT::invierte()
+{ return desde([](int x){return max_color + min_color - x;}); }
+
+
+LUT encadena(const LUT& a, const LUT& b)
+{ return LUT::desde([&](int x){return b[a[x]];}); }
+
+
+LUT encadena(std::initializer_list<LUT> ts)
+{
+    LUT res;
+    for (const LUT& t: ts)
+	res = encadena(res, t);
+
+    return res;
+}
+
+
+LUT_rgb encadena(const LUT_rgb& a, const LUT_rgb& b)
+{
+    return LUT_rgb{encadena(a.r, b.r), encadena(a.g, b.g),
+		   encadena(a.b, b.b)};
+}
+
+
+}// namespace img
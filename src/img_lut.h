@@ -0,0 +1,256 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#ifndef __IMG_LUT_H__
+#define __IMG_LUT_H__
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Tablas de 256 valores (look up tables) para ajustar el
+ *	color: brillo, contraste, gamma, niveles, curvas...
+ *
+ *   - COMENTARIOS: Todos estos ajustes transforman cada canal de forma
+ *	independiente: basta con calcular una tabla con lo que vale cada uno
+ *	de los 256 posibles valores. Varios ajustes se encadenan en una única
+ *	tabla, de tal manera que se recorre la imagen una sola vez:
+ *
+ *	    LUT t = encadena({LUT::brillo(10), LUT::contraste(1.2),
+ *			      LUT::gamma(1.5)});
+ *	    aplica(t, img);		    // los 3 canales
+ *	    aplica(t, imagen_red(img));    // solo el rojo
+ *
+ *	    LUT_rgb t2{LUT::gamma(1.1), LUT{}, LUT::gamma(0.9)};
+ *	    aplica(t2, img);		    // una tabla por canal
+ *
+ *	Los valores de la tabla están siempre en [0, 255]: los ajustes
+ *	recortan el resultado (saturan). Los pixeles con valores fuera de
+ *	[0, 255] se recortan antes de buscarlos en la tabla.
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include <array>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <initializer_list>
+#include <span>
+#include <utility>
+#include <type_traits>
+
+#include "img_image.h"
+#include "img_color.h"
+#include "img_view.h"	// Filas_con_salto
+#include "img_parallel.h"
+
+namespace img{
+
+/*!
+ *  \brief  Tabla de 256 valores en [0, 255].
+ *
+ */
+class LUT{
+public:
+    // Rango de los colores: la tabla se indexa directamente con el color.
+    static constexpr int min_color = std::numeric_limits<Color>::min();
+    static constexpr int max_color = std::numeric_limits<Color>::max();
+    static constexpr int N = std::numeric_limits<Color>::num_colores;
+
+    static_assert(min_color == 0 and N == max_color + 1);
+
+    /// Tabla identidad.
+    LUT();
+
+    /// Tabla con t[x] = f(x) (redondeado y recortado a [0, 255]).
+    template <typename F>
+    static LUT desde(F f);
+
+
+    // Ajustes
+    // -------
+    /// x + delta
+    static LUT brillo(int delta);
+
+    /// centro + (x - centro) * k
+    static LUT contraste(double k, int centro = 128);
+
+    /// 255 * (x / 255)^(1/g): g > 1 aclara, g < 1 oscurece.
+    /// precondición: g > 0
+    static LUT gamma(double g);
+
+    /// Niveles: lleva [negro, blanco] a [salida_negro, salida_blanco]
+    /// aplicando la gamma g entre medias.
+    /// precondición: g > 0
+    static LUT niveles(int negro, int blanco, double g = 1.0,
+		       int salida_negro = min_color,
+		       int salida_blanco = max_color);
+
+    /// Curva lineal a trozos que pasa por los puntos (x, y).
+    /// Antes del primer punto y después del último es constante.
+    /// precondición: puntos ordenados por x, no vacío.
+    static LUT curva(std::span<const std::pair<int, int>> puntos);
+
+    /// 255 - x
+    static LUT invierte();
+
+
+    // Acceso
+    // ------
+    /// Valor de la tabla para x en [0, 255].
+    int operator[](int x) const {return t_[x];}
+
+    /// Valor de la tabla para cualquier x (fuera de [0, 255] se recorta).
+    int operator()(int x) const
+    { return t_[std::clamp(x, min_color, max_color)]; }
+
+    const std::uint8_t* data() const {return t_.data();}
+
+private:
+    std::array<std::uint8_t, N> t_;
+};
+
+
+template <typename F>
+LUT LUT::desde(F f)
+{
+    LUT res;
+    for (int x = 0; x < N; ++x){
+	double y = static_cast<double>(f(x));
+	res.t_[x] = static_cast<std::uint8_t>(
+			    std::clamp(std::lround(y), long{min_color},
+						       long{max_color}));
+    }
+
+    return res;
+}
+
+
+/// Tabla equivalente a aplicar primero a y luego b.
+LUT encadena(const LUT& a, const LUT& b);
+
+/// Tabla equivalente a aplicar todas las tablas, en orden.
+LUT encadena(std::initializer_list<LUT> ts);
+
+
+
+/*!
+ *  \brief  Una tabla para cada canal.
+ *
+ */
+struct LUT_rgb{
+    LUT r, g, b;
+
+    LUT_rgb() = default;
+
+    /// La misma tabla para los 3 canales.
+    LUT_rgb(const LUT& t) : r{t}, g{t}, b{t} {}
+
+    LUT_rgb(const LUT& tr, const LUT& tg, const LUT& tb)
+	: r{tr}, g{tg}, b{tb} {}
+
+    ColorRGB operator()(const ColorRGB& c) const
+    { return ColorRGB{r(c.r), g(c.g), b(c.b)}; }
+};
+
+/// Tabla equivalente a aplicar primero a y luego b.
+LUT_rgb encadena(const LUT_rgb& a, const LUT_rgb& b);
+
+
+
+/****************************************************************************
+ *
+ *   - FUNCIÓN: aplica
+ *
+ *   - DESCRIPCIÓN: Sustituye cada pixel x de img0 por t(x), repartiendo
+ *	las filas entre los hilos.
+ *
+ *	Img puede ser:
+ *	    + Image o Subimage: se aplica a los 3 canales (las filas son
+ *	      contiguas: se recorren con un puntero).
+ *	    + Una vista de un canal (imagen_red, ...) o cualquier contenedor
+ *	      bidimensional de enteros. Si sus filas se pueden ver como
+ *	      puntero + salto (Filas_con_salto) se recorren así.
+ *
+ ****************************************************************************/
+namespace impl_of{
+inline void aplica_fila(const LUT_rgb& t, ColorRGB* p, Ind n)
+{
+    const std::uint8_t* tr = t.r.data();
+    const std::uint8_t* tg = t.g.data();
+    const std::uint8_t* tb = t.b.data();
+
+    constexpr int cmin = LUT::min_color;
+    constexpr int cmax = LUT::max_color;
+
+    for (Ind j = 0; j < n; ++j){
+	p[j].r = tr[std::clamp(p[j].r, cmin, cmax)];
+	p[j].g = tg[std::clamp(p[j].g, cmin, cmax)];
+	p[j].b = tb[std::clamp(p[j].b, cmin, cmax)];
+    }
+}
+}// namespace impl_of
+
+
+template <typename Img>
+void aplica(const LUT_rgb& t, Img&& img0)
+{
+    Ind cols = img0.cols();
+    if (cols == 0)
+	return;
+
+    parallel_for(img0.rows(), [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i)
+	    impl_of::aplica_fila(t, &img0(i, 0), cols);
+    }, cols);
+}
+
+
+template <typename Img>
+void aplica(const LUT& t, Img&& img0)
+{
+    using Pixel = std::remove_cvref_t<decltype(img0(0, 0))>;
+
+    if constexpr (std::is_same_v<Pixel, ColorRGB>)
+	aplica(LUT_rgb{t}, img0);
+
+    else{
+	Ind cols = img0.cols();
+
+	parallel_for(img0.rows(), [&](Ind i0, Ind ie){
+	    for (Ind i = i0; i < ie; ++i){
+		if constexpr (Filas_con_salto<std::remove_reference_t<Img>>)
+		    para_cada(fila_con_salto(img0, i), [&t](auto& x)
+							    { x = t(x); });
+		else
+		    for (Ind j = 0; j < cols; ++j)
+			img0(i, j) = t(img0(i, j));
+	    }
+	}, cols);
+    }
+}
+
+
+}// namespace img
+
+#endif
+
@@ -0,0 +1,221 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Capas transparentes.
+ *
+ *   - COMENTARIOS: compone recorre la zona sucia por filas de teselas
+ *	(repartidas entre los hilos). Para cada fila de cada tesela el bucle
+ *	interior mezcla dos arrays contiguos sin ningún if: el compilador lo
+ *	puede vectorizar.
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include "img_overlay.h"
+#include "img_parallel.h"
+
+#include <algorithm>
+
+namespace img{
+
+static std::uint8_t a_uint8(int x)
+{ return static_cast<std::uint8_t>(std::clamp(x, 0, 255)); }
+
+
+void compone(Pixel_capa& p, const ColorRGB& c, int alfa)
+{
+    if (alfa <= 0)
+	return;
+
+    if (alfa >= 255 or p.a == 0){
+	p = Pixel_capa{a_uint8(c.r), a_uint8(c.g), a_uint8(c.b), a_uint8(alfa)};
+	return;
+    }
+
+    // a = alfa + p.a * (1 - alfa), con alfas en [0, 255]
+    int ad = p.a * (255 - alfa);	    // peso del fondo (x 255)
+    int a  = alfa * 255 + ad;		    // alfa resultante (x 255)
+
+    auto canal = [&](int c1, int c0){
+	return a_uint8((c1 * alfa * 255 + c0 * ad + a / 2) / a);
+    };
+
+    p = Pixel_capa{canal(c.r, p.r), canal(c.g, p.g), canal(c.b, p.b),
+		   a_uint8((a + 127) / 255)};
+}
+
+
+// Capa
+// ----
+Capa::Capa(Ind rows, Ind cols)
+    : rows_{rows}, cols_{cols},
+      nteselas_j_{(cols + lado_tesela - 1) / lado_tesela},
+      teselas_(static_cast<size_t>((rows + lado_tesela - 1) / lado_tesela)
+						       * nteselas_j_)
+{
+    limpia();
+}
+
+
+void Capa::limpia()
+{
+    for (auto& t: teselas_)
+	t.reset();
+
+    sucia_ = Ventana{rows_, 0, cols_, 0};
+}
+
+
+int Capa::num_teselas() const
+{
+    return static_cast<int>(std::count_if(teselas_.begin(), teselas_.end(),
+			    [](const Tesela& t){return t != nullptr;}));
+}
+
+
+Pixel_capa Capa::operator()(Ind i, Ind j) const
+{
+    const Pixel_capa* t = tesela(i / lado_tesela, j / lado_tesela);
+    if (t == nullptr)
+	return Pixel_capa{0, 0, 0, 0};
+
+    return t[(i % lado_tesela) * lado_tesela + j % lado_tesela];
+}
+
+
+Pixel_capa* Capa::pixel(Ind i, Ind j)
+{
+    Tesela& t = teselas_[(i / lado_tesela) * nteselas_j_ + j / lado_tesela];
+
+    if (t == nullptr){
+	t = std::make_unique<Pixel_capa[]>(lado_tesela * lado_tesela);
+	std::fill_n(t.get(), lado_tesela * lado_tesela, Pixel_capa{0, 0, 0, 0});
+    }
+
+    return &t[(i % lado_tesela) * lado_tesela + j % lado_tesela];
+}
+
+
+void Capa::ensucia(Ind i, Ind j0, Ind je)
+{
+    sucia_.i0 = std::min(sucia_.i0, i);
+    sucia_.ie = std::max(sucia_.ie, i + 1);
+    sucia_.j0 = std::min(sucia_.j0, j0);
+    sucia_.je = std::max(sucia_.je, je);
+}
+
+
+void Capa::pinta(Ind i, Ind j, const ColorRGB& c, int alfa)
+{
+    if (alfa <= 0)
+	return;
+
+    compone(*pixel(i, j), c, alfa);
+    ensucia(i, j, j + 1);
+}
+
+
+void Capa::pinta(Ind i, Ind j0, Ind je, const ColorRGB& c, int alfa)
+{
+    if (alfa <= 0 or j0 >= je)
+	return;
+
+    ensucia(i, j0, je);
+
+    // Por trozos: cada trozo está en una tesela (es contiguo)
+    while (j0 < je){
+	Ind jt = std::min(je, (j0 / lado_tesela + 1) * lado_tesela);
+	Pixel_capa* p = pixel(i, j0);
+
+	if (alfa >= 255)
+	    std::fill(p, p + (jt - j0),
+		Pixel_capa{a_uint8(c.r), a_uint8(c.g), a_uint8(c.b), 255});
+	else
+	    for (Ind j = j0; j < jt; ++j, ++p)
+		compone(*p, c, alfa);
+
+	j0 = jt;
+    }
+}
+
+
+
+// compone
+// -------
+// d[k] = mezcla(d[k], p[k], p[k].a)
+static void compone_fila(const Pixel_capa* p, ColorRGB* d, Ind n)
+{
+    for (Ind k = 0; k < n; ++k){
+	int a = p[k].a;
+	int b = 255 - a;
+	d[k].r = (p[k].r * a + d[k].r * b + 127) / 255;
+	d[k].g = (p[k].g * a + d[k].g * b + 127) / 255;
+	d[k].b = (p[k].b * a + d[k].b * b + 127) / 255;
+    }
+}
+
+
+template <typename Img>
+static void compone_(const Capa& capa, Img& img0)
+{
+    if (capa.vacia())
+	return;
+
+    constexpr Ind lado = Capa::lado_tesela;
+    Ventana w = capa.zona_sucia();
+
+    Ind ti0 = w.i0 / lado;
+    Ind tie = (w.ie - 1) / lado + 1;
+    Ind tj0 = w.j0 / lado;
+    Ind tje = (w.je - 1) / lado + 1;
+
+    parallel_for(tie - ti0, [&](Ind k0, Ind ke){
+	for (Ind ti = ti0 + k0; ti < ti0 + ke; ++ti){
+	    Ind i0 = std::max(ti * lado, w.i0);
+	    Ind ie = std::min((ti + 1) * lado, w.ie);
+
+	    for (Ind tj = tj0; tj < tje; ++tj){
+		const Pixel_capa* t = capa.tesela(ti, tj);
+		if (t == nullptr)
+		    continue;
+
+		Ind j0 = std::max(tj * lado, w.j0);
+		Ind je = std::min((tj + 1) * lado, w.je);
+
+		for (Ind i = i0; i < ie; ++i)
+		    compone_fila(t + (i - ti*lado) * lado + (j0 - tj*lado),
+				 &img0(i, j0), je - j0);
+	    }
+	}
+    }, lado * (tje - tj0) * lado);
+}
+
+
+void compone(const Capa& capa, Image& img0)
+{ compone_(capa, img0); }
+
+void compone(const Capa& capa, Subimage& img0)
+{ compone_(capa, img0); }
+
+
+}// namespace img
+
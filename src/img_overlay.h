@@ -0,0 +1,279 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#ifndef __IMG_OVERLAY_H__
+#define __IMG_OVERLAY_H__
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Capas transparentes para dibujar encima de una imagen.
+ *
+ *   - COMENTARIOS: En lugar de dibujar directamente en la imagen (y
+ *	perderla) se dibuja en una capa, que luego se compone encima de la
+ *	imagen. Con una misma imagen base se pueden probar muchas capas.
+ *
+ *	    Capa capa{img.rows(), img.cols()};
+ *	    draw(capa, s, ColorRGB::rojo(), 128);   // rojo semitransparente
+ *	    draw_circulo(capa, c, ColorRGB::verde());
+ *
+ *	    Image res = img;
+ *	    compone(capa, res);
+ *
+ *	La capa está dividida en teselas de 64 x 64 pixeles que solo se
+ *	crean cuando se pinta en ellas: una capa con unas pocas anotaciones
+ *	ocupa muy poca memoria. Además la capa recuerda el rectángulo en el
+ *	que se ha pintado (zona_sucia) y compone solo recorre ese rectángulo.
+ *
+ *	Para dibujar en la capa se usan las mismas funciones rasteriza_*
+ *	que para dibujar en una imagen, con un Pincel_capa.
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <span>
+
+#include "img_image.h"
+#include "img_color.h"
+#include "img_view.h"	// Subimage
+#include "img_draw.h"
+
+namespace img{
+
+/// Pixel de una capa: color y opacidad (alfa = 0 transparente,
+/// alfa = 255 opaco). El color no está premultiplicado por alfa.
+struct Pixel_capa{
+    std::uint8_t r, g, b, a;
+};
+
+
+/*!
+ *  \brief  Capa transparente, dividida en teselas.
+ *
+ *  Inicialmente es totalmente transparente y no ocupa memoria.
+ */
+class Capa{
+public:
+    static constexpr Ind lado_tesela = 64;
+
+    Capa(Ind rows, Ind cols);
+
+    Ind rows() const {return rows_;}
+    Ind cols() const {return cols_;}
+
+    /// Pixel (i, j). Si nunca se ha pintado en su tesela es transparente.
+    Pixel_capa operator()(Ind i, Ind j) const;
+
+    /// Compone el color c con opacidad alfa encima del pixel (i, j).
+    void pinta(Ind i, Ind j, const ColorRGB& c, int alfa);
+
+    /// Compone el color c con opacidad alfa encima de los pixeles [j0, je)
+    /// de la fila i.
+    void pinta(Ind i, Ind j0, Ind je, const ColorRGB& c, int alfa);
+
+    /// Rectángulo en el que se ha pintado desde que se creó la capa o se
+    /// llamó a limpia(). Si no se ha pintado nada está vacío.
+    Ventana zona_sucia() const
+    { return Ventana{sucia_.i0, sucia_.ie, sucia_.j0, sucia_.je}; }
+
+    /// ¿Se ha pintado algo?
+    bool vacia() const {return sucia_.i0 >= sucia_.ie;}
+
+    /// Deja la capa transparente, liberando todas las teselas.
+    void limpia();
+
+    /// Número de teselas creadas.
+    int num_teselas() const;
+
+
+    // Acceso a las teselas (para compone)
+    // -----------------------------------
+    /// Pixeles de la tesela (ti, tj), por filas, o nullptr si no existe.
+    /// La fila i de la tesela empieza en tesela(ti, tj) + i*lado_tesela.
+    const Pixel_capa* tesela(Ind ti, Ind tj) const
+    { return teselas_[ti * nteselas_j_ + tj].get(); }
+
+private:
+    using Tesela = std::unique_ptr<Pixel_capa[]>;
+
+    Ind rows_, cols_;
+    Ind nteselas_j_;
+    std::vector<Tesela> teselas_;
+    Ventana sucia_;
+
+    // Devuelve el pixel (i, j), creando su tesela si no existe.
+    Pixel_capa* pixel(Ind i, Ind j);
+
+    void ensucia(Ind i, Ind j0, Ind je);
+};
+
+
+/// Compone c con opacidad alfa encima de p (operación "over").
+void compone(Pixel_capa& p, const ColorRGB& c, int alfa);
+
+
+/// Pincel para dibujar en una capa con las funciones rasteriza_*.
+/// Todo lo que se dibuja se compone encima de lo que ya hay con opacidad
+/// alfa (multiplicada por la cobertura en rasteriza_aa).
+class Pincel_capa{
+public:
+    Pincel_capa(Capa& capa, const ColorRGB& color, int alfa = 255)
+	: capa_{capa}, color_{color}, alfa_{alfa} {}
+
+    void punto(Ind i, Ind j) {capa_.pinta(i, j, color_, alfa_);}
+
+    void punto(Ind i, Ind j, int cobertura)
+    { capa_.pinta(i, j, color_, (alfa_ * cobertura + 127) / 255); }
+
+    void tramo_h(Ind i, Ind j0, Ind je) {capa_.pinta(i, j0, je, color_, alfa_);}
+
+    void tramo_v(Ind j, Ind i0, Ind ie)
+    {
+	for (Ind i = i0; i < ie; ++i)
+	    capa_.pinta(i, j, color_, alfa_);
+    }
+
+private:
+    Capa& capa_;
+    ColorRGB color_;
+    int alfa_;
+};
+
+
+/// Ventana que cubre toda la capa.
+inline Ventana ventana(const Capa& capa)
+{ return Ventana{0, capa.rows(), 0, capa.cols()}; }
+
+
+
+/****************************************************************************
+ *
+ *   - FUNCIÓN: compone
+ *
+ *   - DESCRIPCIÓN: Compone la capa encima de la imagen img0 (operación
+ *	"over"): img0 = mezcla(img0, color de la capa, alfa de la capa).
+ *
+ *	Solo se recorren las teselas creadas dentro de la zona sucia.
+ *	Img = Image o Subimage (sus filas son contiguas en memoria).
+ *
+ *   - PRECONDICIÓN: capa e img0 tienen el mismo tamaño.
+ *
+ ****************************************************************************/
+void compone(const Capa& capa, Image& img0);
+void compone(const Capa& capa, Subimage& img0);
+
+
+
+/****************************************************************************
+ *
+ *   - FUNCIÓN: draw
+ *
+ *   - DESCRIPCIÓN: Las mismas funciones de dibujo que para Image, pero
+ *	dibujando en una capa con opacidad alfa.
+ *
+ ****************************************************************************/
+inline void draw(Capa& capa, const Segmento& s, const ColorRGB& color,
+							int alfa = 255)
+{
+    Pincel_capa pincel{capa, color, alfa};
+    rasteriza(s, ventana(capa), pincel);
+}
+
+inline void draw(Capa& capa, std::span<const Segmento> ss,
+		 const ColorRGB& color, int alfa = 255)
+{
+    Pincel_capa pincel{capa, color, alfa};
+    for (const Segmento& s: ss)
+	rasteriza(s, ventana(capa), pincel);
+}
+
+inline void draw_aa(Capa& capa, const Segmento& s, const ColorRGB& color,
+							int alfa = 255)
+{
+    Pincel_capa pincel{capa, color, alfa};
+    rasteriza_aa(s, ventana(capa), pincel);
+}
+
+inline void draw_grueso(Capa& capa, const Segmento& s, int ancho,
+			const ColorRGB& color, int alfa = 255,
+			Extremo extremo = Extremo::redondo)
+{
+    Pincel_capa pincel{capa, color, alfa};
+    rasteriza_grueso(s, ancho, extremo, ventana(capa), pincel);
+}
+
+inline void draw(Capa& capa, const Rectangulo& r, const ColorRGB& color,
+							int alfa = 255)
+{
+    Pincel_capa pincel{capa, color, alfa};
+    Ventana w = ventana(capa);
+    Position p0 = r.upper_left_corner();
+    Position pe = r.bottom_right_corner();
+
+    // Sin repetir las esquinas (importante si alfa < 255)
+    rasteriza(Segmento{p0, Position{p0.i, pe.j}}, w, pincel);
+    if (pe.i != p0.i)
+	rasteriza(Segmento{Position{pe.i, p0.j}, pe}, w, pincel);
+    if (pe.i - p0.i > 1){
+	rasteriza(Segmento{Position{p0.i + 1, p0.j}, Position{pe.i - 1, p0.j}},
+								    w, pincel);
+	if (pe.j != p0.j)
+	    rasteriza(Segmento{Position{p0.i + 1, pe.j},
+			       Position{pe.i - 1, pe.j}}, w, pincel);
+    }
+}
+
+inline void draw_relleno(Capa& capa, const Rectangulo& r,
+			 const ColorRGB& color, int alfa = 255)
+{
+    Pincel_capa pincel{capa, color, alfa};
+    rasteriza_rectangulo(r, ventana(capa), pincel);
+}
+
+inline void draw_circunferencia(Capa& capa, const Circulo& c,
+				const ColorRGB& color, int alfa = 255)
+{
+    Pincel_capa pincel{capa, color, alfa};
+    rasteriza_circunferencia(c, false, ventana(capa), pincel);
+}
+
+inline void draw_circulo(Capa& capa, const Circulo& c,
+			 const ColorRGB& color, int alfa = 255)
+{
+    Pincel_capa pincel{capa, color, alfa};
+    rasteriza_circunferencia(c, true, ventana(capa), pincel);
+}
+
+inline void draw_poligono_relleno(Capa& capa, std::span<const Position> ps,
+		    const ColorRGB& color, int alfa = 255,
+		    Regla_relleno regla = Regla_relleno::par_impar)
+{
+    Pincel_capa pincel{capa, color, alfa};
+    rasteriza_poligono(ps, regla, ventana(capa), pincel);
+}
+
+
+}// namespace img
+
+#endif
+
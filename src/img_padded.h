@@ -0,0 +1,304 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#ifndef __IMG_PADDED_H__
+#define __IMG_PADDED_H__
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Imágenes con un borde de k pixeles alrededor.
+ *
+ *   - COMENTARIOS: Los filtros que miran los vecinos de cada pixel tienen
+ *	que tratar aparte los bordes (o comprobar en cada paso si se salen
+ *	de la imagen). Con un borde de k pixeles alrededor de la imagen
+ *	podemos leer cualquier vecino a distancia <= k sin comprobar nada:
+ *
+ *	    Image_con_borde img1{img0, 1, Relleno_borde::replica};
+ *
+ *	    for (Ind i = 0; i < img1.rows(); ++i){
+ *		const ColorRGB* p = img1.fila(i);
+ *		Ind s = img1.salto_fila();
+ *		for (Ind j = 0; j < img1.cols(); ++j)
+ *		    ... p[j - s] (arriba), p[j + 1] (dcha), p[j + s - 1] ...
+ *	    }
+ *
+ *	Las posiciones son las de la imagen: (0, 0) es el primer pixel de la
+ *	imagen y el borde ocupa las posiciones -k <= i < 0, rows <= i < rows
+ *	+ k (y lo mismo con j).
+ *
+ *	Formas de rellenar el borde (rows = 5: a b c d e):
+ *	    + constante: x x | a b c d e | x x
+ *	    + replica  : a a | a b c d e | e e
+ *	    + espejo   : c b | a b c d e | d c  (sin repetir el del borde)
+ *
+ *	El borde no se actualiza solo: si se modifica la imagen (a través de
+ *	interior(), por ejemplo) hay que volver a llamar a rellena_borde.
+ *
+ *	Iterator2D_t<Image_con_borde> puede salirse hasta k pixeles de la
+ *	imagen sin dejar de poder dereferenciarse.
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <type_traits>
+
+#include "img_image.h"
+#include "img_color.h"
+#include "img_view.h"	// Subimage
+#include "img_parallel.h"
+
+namespace img{
+
+/// Forma de rellenar el borde.
+enum class Relleno_borde{ constante, replica, espejo };
+
+
+namespace impl_of{
+// Valor por defecto del borde constante (ColorRGB{} no inicializa).
+template <typename T>
+inline T cero()
+{
+    if constexpr (std::is_same_v<T, ColorRGB>)
+	return ColorRGB{0, 0, 0};
+    else
+	return T{};
+}
+
+// Posición de la imagen [0, n) con la que se rellena la posición i del
+// borde (i < 0 ó i >= n).
+inline Ind indice_borde(Ind i, Ind n, Relleno_borde r)
+{
+    if (r == Relleno_borde::replica)
+	return std::clamp(i, Ind{0}, n - 1);
+
+    // espejo: el periodo es 2(n - 1)
+    if (n == 1)
+	return 0;
+
+    Ind periodo = 2 * (n - 1);
+    i = std::abs(i) % periodo;
+    return (i < n? i: periodo - i);
+}
+// Se llama en la lista de inicialización: hay que validar el borde antes
+// de construir la matriz con él.
+inline Ind borde_valido(Ind k)
+{
+    if (k < 0)
+	throw std::logic_error{"Image_con_borde: el borde no puede ser negativo"};
+    return k;
+}
+
+}// namespace impl_of
+
+
+/*!
+ *  \brief  Imagen de elementos T con un borde de k pixeles.
+ *
+ *  Por dentro es una matriz de (rows + 2k) x (cols + 2k). Las filas están
+ *  contiguas y una detrás de otra: el vecino (di, dj) de p = fila(i) + j
+ *  es p[di * salto_fila() + dj], para |di|, |dj| <= k.
+ *
+ */
+template <typename T>
+class Image_con_borde_t{
+public:
+    using value_type = T;
+    using Ind	     = img::Ind;
+    using size_type  = Ind;
+    using Matriz     = alp::Matrix<T, Ind>;
+
+
+    // Construcción
+    // ------------
+    /// Imagen de sz pixeles con un borde de k pixeles, sin inicializar.
+    Image_con_borde_t(Size2D sz, Ind k);
+
+    /// Copia img0 y rellena el borde. 
+    /// Img = cualquier contenedor bidimensional de T (Image, Subimage,
+    /// Plane, vistas...).
+    template <typename Img>
+    Image_con_borde_t(const Img& img0, Ind k,
+		      Relleno_borde r = Relleno_borde::replica,
+		      const T& valor = impl_of::cero<T>());
+
+
+    // Dimensiones (de la imagen, sin contar el borde)
+    // -----------------------------------------------
+    Ind rows() const {return rows_;}
+    Ind cols() const {return cols_;}
+    Size2D size2D() const {return Size2D{rows_, cols_};}
+
+    /// Tamaño del borde.
+    Ind borde() const {return k_;}
+
+    /// Número de elementos entre el principio de dos filas consecutivas
+    /// (= cols() + 2 * borde()).
+    Ind salto_fila() const {return cols_ + 2 * k_;}
+
+
+    // Acceso
+    // ------
+    /// Pixel (i, j) de la imagen o del borde.
+    /// precondición: -borde() <= i < rows() + borde(), ídem j.
+    T& operator()(Ind i, Ind j) {return m_(i + k_, j + k_);}
+    const T& operator()(Ind i, Ind j) const {return m_(i + k_, j + k_);}
+
+    T& operator()(Position p) {return (*this)(p.i, p.j);}
+    const T& operator()(Position p) const {return (*this)(p.i, p.j);}
+
+    /// Puntero al pixel (i, 0). Se puede indexar con j en 
+    /// [-borde(), cols() + borde()).
+    T* fila(Ind i) {return &m_(i + k_, k_);}
+    const T* fila(Ind i) const {return &m_(i + k_, k_);}
+
+    /// La imagen, sin el borde.
+    alp::Submatrix<Matriz> interior()
+    { return alp::Submatrix<Matriz>{m_, Position{k_, k_}, size2D()}; }
+
+    alp::Submatrix<const Matriz> interior() const
+    { return alp::Submatrix<const Matriz>{m_, Position{k_, k_}, size2D()}; }
+
+    /// Imagen con el borde.
+    const Matriz& matriz() const {return m_;}
+
+
+    // Borde
+    // -----
+    /// Rellena el borde a partir de la imagen.
+    void rellena_borde(Relleno_borde r = Relleno_borde::replica,
+		       const T& valor = impl_of::cero<T>());
+
+private:
+    Ind rows_, cols_;
+    Ind k_;
+    Matriz m_;	// (rows + 2k) x (cols + 2k)
+
+    void rellena_filas(Relleno_borde r, const T& valor);
+    void rellena_columnas(Relleno_borde r, const T& valor);
+};
+
+
+using Image_con_borde = Image_con_borde_t<ColorRGB>;
+
+template <typename T>
+using Plane_con_borde = Image_con_borde_t<T>;
+
+
+/// ¿Pertenece p a la imagen (sin el borde)?
+template <typename T>
+inline bool pertenece(const Position& p, const Image_con_borde_t<T>& img0)
+{ return 0 <= p.i and p.i < img0.rows() and 0 <= p.j and p.j < img0.cols(); }
+
+
+
+template <typename T>
+Image_con_borde_t<T>::Image_con_borde_t(Size2D sz, Ind k)
+    : rows_{sz.rows}, cols_{sz.cols}, k_{impl_of::borde_valido(k)},
+      m_{sz.rows + 2 * k_, sz.cols + 2 * k_}
+{ }
+
+
+template <typename T>
+template <typename Img>
+Image_con_borde_t<T>::Image_con_borde_t(const Img& img0, Ind k,
+					Relleno_borde r, const T& valor)
+    : Image_con_borde_t{Size2D{img0.rows(), img0.cols()}, k}
+{
+    parallel_for(rows_, [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i){
+	    T* p = fila(i);
+	    for (Ind j = 0; j < cols_; ++j)
+		p[j] = img0(i, j);
+	}
+    }, cols_);
+
+    rellena_borde(r, valor);
+}
+
+
+template <typename T>
+void Image_con_borde_t<T>::rellena_borde(Relleno_borde r, const T& valor)
+{
+    if (k_ == 0)
+	return;
+
+    if (rows_ == 0 or cols_ == 0){ // no hay nada que replicar
+	std::fill(m_.begin(), m_.end(), valor);
+	return;
+    }
+
+    // Primero las columnas de las filas de la imagen, luego las filas
+    // completas (incluidas las esquinas).
+    rellena_columnas(r, valor);
+    rellena_filas(r, valor);
+}
+
+
+template <typename T>
+void Image_con_borde_t<T>::rellena_columnas(Relleno_borde r, const T& valor)
+{
+    for (Ind i = 0; i < rows_; ++i){
+	T* p = fila(i);
+
+	if (r == Relleno_borde::constante){
+	    std::fill(p - k_, p, valor);
+	    std::fill(p + cols_, p + cols_ + k_, valor);
+	}
+	else{
+	    for (Ind j = 1; j <= k_; ++j){
+		p[-j] = p[impl_of::indice_borde(-j, cols_, r)];
+		p[cols_ - 1 + j] = p[impl_of::indice_borde(cols_ - 1 + j, cols_, r)];
+	    }
+	}
+    }
+}
+
+
+template <typename T>
+void Image_con_borde_t<T>::rellena_filas(Relleno_borde r, const T& valor)
+{
+    Ind n = salto_fila();
+
+    for (Ind i = 1; i <= k_; ++i){
+	T* arriba = fila(-i) - k_;
+	T* abajo  = fila(rows_ - 1 + i) - k_;
+
+	if (r == Relleno_borde::constante){
+	    std::fill(arriba, arriba + n, valor);
+	    std::fill(abajo, abajo + n, valor);
+	}
+	else{
+	    const T* p = fila(impl_of::indice_borde(-i, rows_, r)) - k_;
+	    const T* q = fila(impl_of::indice_borde(rows_ - 1 + i, rows_, r)) - k_;
+	    std::copy(p, p + n, arriba);
+	    std::copy(q, q + n, abajo);
+	}
+    }
+}
+
+
+}// namespace img
+
+#endif
+
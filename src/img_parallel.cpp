@@ -0,0 +1,49 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "img_parallel.h"
+
+#include <atomic>
+
+namespace img{
+
+static unsigned hilos_por_defecto()
+{
+    unsigned n = std::thread::hardware_concurrency();
+
+    if (n == 0) // no se sabe cuántos hay
+	return 1;
+
+    return n;
+}
+
+static std::atomic<unsigned> num_threads_ = hilos_por_defecto();
+
+unsigned num_threads() { return num_threads_; }
+
+void num_threads(unsigned n)
+{
+    if (n == 0)
+	n = 1;
+
+    num_threads_ = n;
+}
+
+
+}// namespace
+
@@ -0,0 +1,138 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#ifndef __IMG_PARALLEL_H__
+#define __IMG_PARALLEL_H__
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Reparto de trabajo entre varios hilos.
+ *
+ *   - COMENTARIOS: La mayoría de los algoritmos sobre imágenes recorren la
+ *	imagen por filas. La forma más sencilla de paralelizarlos es dividir
+ *	las filas en bandas [i0, ie) y darle una banda a cada hilo.
+ *
+ *	    parallel_for(img.rows(), [&](Ind i0, Ind ie){
+ *		for (Ind i = i0; i < ie; ++i)
+ *		    ...
+ *	    });
+ *
+ *	Si la imagen es pequeña no merece la pena crear hilos: en ese caso
+ *	se ejecuta todo en el hilo que llama.
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include <exception>
+#include <functional>	// ref
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include "img_image.h"	// Ind
+
+namespace img{
+
+/// Número de hilos que usan los algoritmos paralelos.
+/// Por defecto es std::thread::hardware_concurrency().
+unsigned num_threads();
+
+/// Fija el número de hilos que usarán los algoritmos paralelos.
+/// num_threads(1) hace que todo se ejecute en el hilo que llama.
+void num_threads(unsigned n);
+
+
+/// Número mínimo de elementos que tiene que procesar cada hilo. Por
+/// debajo de esto cuesta más crear el hilo que hacer el trabajo.
+inline constexpr Ind parallel_min_elementos = 1 << 16;
+
+
+/// Divide [0, n) en bandas y llama a f(i0, ie) para cada una de ellas,
+/// cada una en un hilo diferente.
+///
+/// 'coste' es el número de elementos que procesa f por cada índice
+/// (normalmente el número de columnas de la imagen). Lo usamos para no
+/// crear hilos cuando hay poco trabajo.
+///
+/// Si f lanza una excepción en alguna banda, se espera a que terminen
+/// todas y se relanza (la de la primera banda que falló).
+template <typename F>
+void parallel_for(Ind n, F f, Ind coste = 1)
+{
+    if (n <= 0)
+	return;
+
+    Ind max_bandas = std::max<Ind>(1,
+		    (static_cast<long long>(n) * coste) / parallel_min_elementos);
+
+    Ind nbandas = std::min<Ind>({n, max_bandas,
+				    static_cast<Ind>(num_threads())});
+
+    if (nbandas <= 1){
+	f(Ind{0}, n);
+	return;
+    }
+
+    // Excepción lanzada en cada banda: se relanza la primera después de
+    // que hayan terminado todos los hilos.
+    std::vector<std::exception_ptr> errores(nbandas);
+
+    // Cada hilo recibe su propia copia de f.
+    auto banda = [](F g, Ind i0, Ind ie, std::exception_ptr& error){
+	try{
+	    g(i0, ie);
+	}catch(...){
+	    error = std::current_exception();
+	}
+    };
+
+    {// jthread: si algo falla (incluso al crear un hilo) se espera a los
+     // hilos ya creados al salir de este bloque.
+    std::vector<std::jthread> hilos;
+    hilos.reserve(nbandas - 1);
+
+    Ind ancho = n / nbandas;
+    Ind resto = n % nbandas;
+
+    Ind i0 = 0;
+    for (Ind b = 0; b < nbandas; ++b){
+	Ind ie = i0 + ancho + (b < resto? 1: 0);
+
+	if (b == nbandas - 1) // la última banda la hace el hilo que llama
+	    banda(f, i0, ie, errores[b]);
+	else
+	    hilos.emplace_back(banda, f, i0, ie, std::ref(errores[b]));
+
+	i0 = ie;
+    }
+    }
+
+    for (auto& e: errores)
+	if (e)
+	    std::rethrow_exception(e);
+}
+
+
+}// namespace
+
+#endif
+
+
@@ -0,0 +1,361 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#ifndef __IMG_QUALITY_H__
+#define __IMG_QUALITY_H__
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Medidas de la calidad de una imagen comparada con una
+ *	de referencia: MSE, PSNR, SSIM y MS-SSIM.
+ *
+ *   - COMENTARIOS: Todas las funciones admiten:
+ *	    + Imágenes de un canal: imagen_red(img), Plane<int>, ...
+ *	    + Image (o Subimage): se calcula la medida de cada canal y se
+ *	      devuelve la media.
+ *
+ *	    double e = mse(ref, img);
+ *	    double p = psnr(ref, img);	    // en dB
+ *	    double s = ssim(ref, img);	    // en [-1, 1], 1 = iguales
+ *	    double m = ms_ssim(ref, img);
+ *
+ *	SSIM se calcula con una ventana cuadrada (todos los pesos iguales)
+ *	de lado 8 que recorre toda la imagen. Las medias, varianzas y la
+ *	covarianza de cada ventana se obtienen de imágenes integrales de x,
+ *	y, x^2, y^2 y x*y: el coste no depende del tamaño de la ventana.
+ *
+ *	MS-SSIM calcula SSIM a 5 escalas (dividiendo cada vez la imagen a la
+ *	mitad) con los pesos de Wang, Simoncelli y Bovik (2003). Si la
+ *	imagen es demasiado pequeña se usan solo las escalas en las que cabe
+ *	la ventana.
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <algorithm>
+
+#include "img_image.h"
+#include "img_color.h"
+#include "img_view.h"
+#include "img_integral.h"
+#include "img_parallel.h"
+
+namespace img{
+
+namespace impl_of{
+template <typename Img>
+using Pixel_de =
+	    std::remove_cvref_t<decltype(std::declval<const Img&>()(0, 0))>;
+
+template <typename Img>
+inline constexpr bool es_rgb = std::is_same_v<Pixel_de<Img>, ColorRGB>;
+
+// ¿Podemos recorrer a y b con puntero + salto?
+template <typename Img1, typename Img2>
+inline constexpr bool con_salto = 
+		    Filas_con_salto<const Img1> and Filas_con_salto<const Img2>;
+
+template <typename Img1, typename Img2>
+void comprueba_tamanos_calidad(const Img1& a, const Img2& b)
+{
+    if (a.rows() != b.rows() or a.cols() != b.cols())
+	throw std::logic_error{"calidad: las imágenes tienen distinto tamaño"};
+}
+
+// Aplica f a cada canal de a y b y devuelve la media.
+template <typename Img1, typename Img2, typename F>
+double media_canales(const Img1& a, const Img2& b, F f)
+{
+    return (f(const_imagen_red(a), const_imagen_red(b)) +
+	    f(const_imagen_green(a), const_imagen_green(b)) +
+	    f(const_imagen_blue(a), const_imagen_blue(b))) / 3.0;
+}
+}// namespace impl_of
+
+
+
+/***************************************************************************
+ *				MSE
+ ***************************************************************************/
+/// Error cuadrático medio entre a y b.
+template <typename Img1, typename Img2>
+double mse(const Img1& a, const Img2& b)
+{
+    impl_of::comprueba_tamanos_calidad(a, b);
+
+    Ind rows = a.rows();
+    Ind cols = a.cols();
+    if (rows == 0 or cols == 0)
+	return 0.0;
+
+    double total = 0;
+    std::mutex m;
+
+    parallel_for(rows, [&](Ind i0, Ind ie){
+	double suma = 0;
+
+	for (Ind i = i0; i < ie; ++i){
+	    std::int64_t fila = 0;  // como mucho 3 * 255^2 * cols
+
+	    if constexpr (impl_of::es_rgb<Img1>){
+		for (Ind j = 0; j < cols; ++j){
+		    const ColorRGB& x = a(i, j);
+		    const ColorRGB& y = b(i, j);
+		    std::int64_t dr = x.r - y.r, dg = x.g - y.g, db = x.b - y.b;
+		    fila += dr*dr + dg*dg + db*db;
+		}
+	    }
+	    else if constexpr (impl_of::con_salto<Img1, Img2>){
+		para_cada(fila_con_salto(a, i), fila_con_salto(b, i),
+			  [&fila](int x, int y){
+			      std::int64_t d = x - y;
+			      fila += d*d;
+			  });
+	    }
+	    else{
+		for (Ind j = 0; j < cols; ++j){
+		    std::int64_t d = a(i, j) - b(i, j);
+		    fila += d*d;
+		}
+	    }
+
+	    suma += static_cast<double>(fila);
+	}
+
+	std::lock_guard<std::mutex> lock{m};
+	total += suma;
+    }, cols);
+
+    double n = static_cast<double>(rows) * cols;
+    if constexpr (impl_of::es_rgb<Img1>)
+	n *= 3;
+
+    return total / n;
+}
+
+
+
+/***************************************************************************
+ *				PSNR
+ ***************************************************************************/
+/// PSNR (en dB) correspondiente al error cuadrático medio e, siendo
+/// max el máximo valor posible de un pixel. Si e == 0 devuelve infinito.
+inline double psnr(double e, double max = 255.0)
+{
+    if (e <= 0.0)
+	return std::numeric_limits<double>::infinity();
+
+    return 10.0 * std::log10(max * max / e);
+}
+
+template <typename Img1, typename Img2>
+inline double psnr(const Img1& a, const Img2& b)
+{ return psnr(mse(a, b)); }
+
+
+
+/***************************************************************************
+ *				SSIM
+ ***************************************************************************/
+namespace impl_of{
+// Medias de SSIM = l * cs y de cs de todas las ventanas lado x lado de a y
+// b (l: luminancia; cs: contraste y estructura).
+struct Ssim_medias{
+    double ssim = 0;
+    double cs = 0;
+};
+
+template <typename Img1, typename Img2>
+Ssim_medias ssim_medias(const Img1& a, const Img2& b, Ind lado)
+{
+    constexpr double C1 = (0.01 * 255) * (0.01 * 255);
+    constexpr double C2 = (0.03 * 255) * (0.03 * 255);
+
+    Ind rows = a.rows();
+    Ind cols = a.cols();
+
+    // Productos x*y
+    Plane<int> xy{rows, cols};
+    parallel_for(rows, [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i){
+	    int* p = &xy(i, 0);
+
+	    if constexpr (con_salto<Img1, Img2>){
+		para_cada(fila_con_salto(a, i), fila_con_salto(b, i),
+			  [&p](int x, int y){ *p++ = x * y; });
+	    }
+	    else
+		for (Ind j = 0; j < cols; ++j)
+		    p[j] = a(i, j) * b(i, j);
+	}
+    }, cols);
+
+    Integral_image Sa{a, true};
+    Integral_image Sb{b, true};
+    Integral_image Sab{xy};
+
+    Ind ni = rows - lado + 1;	// número de ventanas
+    Ind nj = cols - lado + 1;
+    double N = static_cast<double>(lado) * lado;
+
+    Ssim_medias total;
+    std::mutex m;
+
+    parallel_for(ni, [&](Ind i0, Ind ie){
+	Ssim_medias res;
+
+	for (Ind i = i0; i < ie; ++i)
+	    for (Ind j = 0; j < nj; ++j){
+		Position p0{i, j};
+		Position pe{i + lado - 1, j + lado - 1};
+
+		double mx = Sa.suma(p0, pe) / N;
+		double my = Sb.suma(p0, pe) / N;
+		double vx = Sa.suma_cuadrados(p0, pe) / N - mx * mx;
+		double vy = Sb.suma_cuadrados(p0, pe) / N - my * my;
+		double cxy = Sab.suma(p0, pe) / N - mx * my;
+
+		double l  = (2 * mx * my + C1) / (mx * mx + my * my + C1);
+		double cs = (2 * cxy + C2) / (vx + vy + C2);
+
+		res.cs += cs;
+		res.ssim += l * cs;
+	    }
+
+	std::lock_guard<std::mutex> lock{m};
+	total.cs += res.cs;
+	total.ssim += res.ssim;
+    }, nj * 16);
+
+    double n = static_cast<double>(ni) * nj;
+    total.cs /= n;
+    total.ssim /= n;
+
+    return total;
+}
+
+
+// Reduce la imagen a la mitad, haciendo la media de cada bloque 2 x 2.
+template <typename Img>
+Plane<int> mitad(const Img& img0)
+{
+    Ind rows = img0.rows() / 2;
+    Ind cols = img0.cols() / 2;
+    Plane<int> res{rows, cols};
+
+    parallel_for(rows, [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i)
+	    for (Ind j = 0; j < cols; ++j)
+		res(i, j) = (img0(2*i, 2*j) + img0(2*i, 2*j + 1) +
+			     img0(2*i + 1, 2*j) + img0(2*i + 1, 2*j + 1) + 2) / 4;
+    }, 4 * cols);
+
+    return res;
+}
+
+
+template <typename Img1, typename Img2>
+void comprueba_ventana(const Img1& a, const Img2& b, Ind lado)
+{
+    comprueba_tamanos_calidad(a, b);
+
+    if (lado <= 0 or a.rows() < lado or a.cols() < lado)
+	throw std::logic_error{"ssim: la imagen es más pequeña que la ventana"};
+}
+}// namespace impl_of
+
+
+/// SSIM medio entre a y b, con ventanas de lado x lado.
+/// precondición: a y b tienen el mismo tamaño, mayor que la ventana.
+template <typename Img1, typename Img2>
+double ssim(const Img1& a, const Img2& b, Ind lado = 8)
+{
+    impl_of::comprueba_ventana(a, b, lado);
+
+    if constexpr (impl_of::es_rgb<Img1>)
+	return impl_of::media_canales(a, b, [lado](const auto& x, const auto& y)
+				    { return ssim(x, y, lado); });
+    else
+	return impl_of::ssim_medias(a, b, lado).ssim;
+}
+
+
+/// SSIM multiescala (MS-SSIM) entre a y b, con ventanas de lado x lado.
+/// Usa como mucho 'escalas' escalas (y como mucho 5).
+/// precondición: a y b tienen el mismo tamaño, mayor que la ventana.
+template <typename Img1, typename Img2>
+double ms_ssim(const Img1& a, const Img2& b, Ind lado = 8, int escalas = 5)
+{
+    impl_of::comprueba_ventana(a, b, lado);
+
+    if constexpr (impl_of::es_rgb<Img1>)
+	return impl_of::media_canales(a, b, [=](const auto& x, const auto& y)
+				    { return ms_ssim(x, y, lado, escalas); });
+    else{
+	constexpr double peso[5] = {0.0448, 0.2856, 0.3001, 0.2363, 0.1333};
+
+	// Escalas en las que cabe la ventana
+	escalas = std::clamp(escalas, 1, 5);
+	int M = 1;
+	for (Ind r = a.rows() / 2, c = a.cols() / 2;
+	     M < escalas and r >= lado and c >= lado; r /= 2, c /= 2)
+	    ++M;
+
+	double suma_pesos = 0;
+	for (int k = 0; k < M; ++k)
+	    suma_pesos += peso[k];
+
+	// Escala 0: la imagen original
+	impl_of::Ssim_medias s = impl_of::ssim_medias(a, b, lado);
+	if (M == 1)
+	    return s.ssim;
+
+	double res = std::pow(std::max(s.cs, 0.0), peso[0] / suma_pesos);
+
+	Plane<int> x = impl_of::mitad(a);
+	Plane<int> y = impl_of::mitad(b);
+
+	for (int k = 1; k < M; ++k){
+	    s = impl_of::ssim_medias(x, y, lado);
+
+	    if (k == M - 1)   // en la última escala también la luminancia
+		res *= std::pow(std::max(s.ssim, 0.0), peso[k] / suma_pesos);
+	    else{
+		res *= std::pow(std::max(s.cs, 0.0), peso[k] / suma_pesos);
+		x = impl_of::mitad(x);
+		y = impl_of::mitad(y);
+	    }
+	}
+
+	return res;
+    }
+}
+
+
+}// namespace img
+
+#endif
+
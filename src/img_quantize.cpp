@@ -0,0 +1,537 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Cuantización de colores.
+ *
+ *   - COMENTARIOS: El histograma se calcula en paralelo: cada hilo rellena
+ *	su propio histograma y al final se suman todos.
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include "img_quantize.h"
+#include "img_parallel.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <mutex>
+
+namespace img{
+
+static int a_8bits(int x)
+{ return std::clamp(x, 0, 255); }
+
+static int limita_ncolores(int n)
+{ return std::clamp(n, 1, 256); }
+
+
+/***************************************************************************
+ *			    HISTOGRAMA
+ ***************************************************************************/
+// Número de pixeles y suma de sus colores
+namespace {
+struct Celda{
+    std::uint64_t n;
+    std::uint64_t r, g, b;
+
+    void suma(const Celda& c)
+    {
+	n += c.n;
+	r += c.r;
+	g += c.g;
+	b += c.b;
+    }
+
+    ColorRGB media() const
+    {
+	return ColorRGB{static_cast<int>((r + n/2) / n),
+			static_cast<int>((g + n/2) / n),
+			static_cast<int>((b + n/2) / n)};
+    }
+};
+
+// Celda ocupada del histograma
+struct Color_h{
+    int k;		// índice de la celda: r5 << 10 | g5 << 5 | b5
+    int c[3];		// color medio de la celda
+    Celda celda;
+};
+}// namespace
+
+
+// Histograma de 32 x 32 x 32 celdas. Solo devuelve las celdas ocupadas.
+template <typename Img>
+static std::vector<Color_h> histograma(const Img& img0)
+{
+    constexpr int N = 32 * 32 * 32;
+
+    Ind rows = img0.rows();
+    Ind cols = img0.cols();
+
+    std::vector<Celda> total(N, Celda{0, 0, 0, 0});
+    std::mutex m;
+
+    parallel_for(rows, [&](Ind i0, Ind ie){
+	std::vector<Celda> h(N, Celda{0, 0, 0, 0});
+
+	for (Ind i = i0; i < ie; ++i){
+	    const ColorRGB* p = &img0(i, 0);
+	    for (Ind j = 0; j < cols; ++j){
+		int r = a_8bits(p[j].r);
+		int g = a_8bits(p[j].g);
+		int b = a_8bits(p[j].b);
+
+		Celda& c = h[((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3)];
+		++c.n;
+		c.r += r;
+		c.g += g;
+		c.b += b;
+	    }
+	}
+
+	std::lock_guard<std::mutex> lock{m};
+	for (int k = 0; k < N; ++k)
+	    total[k].suma(h[k]);
+    }, cols);
+
+    std::vector<Color_h> res;
+    for (int k = 0; k < N; ++k)
+	if (total[k].n != 0){
+	    ColorRGB c = total[k].media();
+	    res.push_back(Color_h{k, {c.r, c.g, c.b}, total[k]});
+	}
+
+    return res;
+}
+
+
+
+/***************************************************************************
+ *			    MEDIAN CUT
+ ***************************************************************************/
+namespace {
+// Caja con los colores [b, e) del histograma
+struct Caja{
+    size_t b, e;
+    std::uint64_t n;	// número de pixeles
+    int eje;		// lado más largo (0 = r, 1 = g, 2 = b)
+    int lado;		// longitud del lado más largo
+};
+}// namespace
+
+static Caja caja(const std::vector<Color_h>& hs, size_t b, size_t e)
+{
+    int mn[3] = {255, 255, 255};
+    int mx[3] = {0, 0, 0};
+    std::uint64_t n = 0;
+
+    for (size_t k = b; k < e; ++k){
+	for (int x = 0; x < 3; ++x){
+	    mn[x] = std::min(mn[x], hs[k].c[x]);
+	    mx[x] = std::max(mx[x], hs[k].c[x]);
+	}
+	n += hs[k].celda.n;
+    }
+
+    int eje = 0;
+    for (int x = 1; x < 3; ++x)
+	if (mx[x] - mn[x] > mx[eje] - mn[eje])
+	    eje = x;
+
+    return Caja{b, e, n, eje, mx[eje] - mn[eje]};
+}
+
+
+static Paleta median_cut(std::vector<Color_h> hs, int ncolores)
+{
+    ncolores = limita_ncolores(ncolores);
+
+    if (hs.empty())
+	return Paleta{};
+
+    std::vector<Caja> cajas{caja(hs, 0, hs.size())};
+
+    while (cajas.size() < static_cast<size_t>(ncolores)){
+	// Partimos la caja más grande (pixeles x lado)
+	auto p = std::max_element(cajas.begin(), cajas.end(),
+		[](const Caja& x, const Caja& y){
+		    return x.n * x.lado < y.n * y.lado;});
+
+	if (p->lado == 0)   // todas tienen un único color
+	    break;
+
+	Caja k = *p;
+	std::sort(hs.begin() + k.b, hs.begin() + k.e,
+		[eje = k.eje](const Color_h& x, const Color_h& y){
+		    return x.c[eje] < y.c[eje];});
+
+	// Mediana (por número de pixeles); las dos mitades no vacías
+	std::uint64_t acumulado = 0;
+	size_t m = k.b;
+	while (m < k.e - 1){
+	    acumulado += hs[m].celda.n;
+	    ++m;
+	    if (2 * acumulado >= k.n)
+		break;
+	}
+
+	*p = caja(hs, k.b, m);
+	cajas.push_back(caja(hs, m, k.e));
+    }
+
+    Paleta res;
+    for (const Caja& k: cajas){
+	Celda c{0, 0, 0, 0};
+	for (size_t i = k.b; i < k.e; ++i)
+	    c.suma(hs[i].celda);
+
+	res.push_back(c.media());
+    }
+
+    return res;
+}
+
+
+Paleta paleta_median_cut(const Image& img0, int ncolores)
+{ return median_cut(histograma(img0), ncolores); }
+
+Paleta paleta_median_cut(const Subimage& img0, int ncolores)
+{ return median_cut(histograma(img0), ncolores); }
+
+
+
+/***************************************************************************
+ *			    OCTREE
+ ***************************************************************************/
+namespace {
+struct Nodo{
+    std::array<int, 8> hijo;	// -1 si no existe
+    Celda celda;
+    int nivel;
+    bool hoja;
+};
+}// namespace
+
+static Paleta octree(const std::vector<Color_h>& hs, int ncolores)
+{
+    ncolores = limita_ncolores(ncolores);
+
+    if (hs.empty())
+	return Paleta{};
+
+    // Las celdas del histograma tienen 5 bits por canal: las hojas están
+    // en el nivel 5.
+    constexpr int nbits = 5;
+
+    std::vector<Nodo> nodos;
+    auto nuevo = [&](int nivel){
+	std::array<int, 8> h;
+	h.fill(-1);
+	nodos.push_back(Nodo{h, Celda{0, 0, 0, 0}, nivel, nivel == nbits});
+	return static_cast<int>(nodos.size() - 1);
+    };
+
+    nuevo(0);
+
+    for (const Color_h& h: hs){
+	int r5 = h.k >> 10;
+	int g5 = (h.k >> 5) & 31;
+	int b5 = h.k & 31;
+
+	int x = 0;
+	nodos[x].celda.suma(h.celda);
+	for (int nivel = 0; nivel < nbits; ++nivel){
+	    int bit = nbits - 1 - nivel;
+	    int i = (((r5 >> bit) & 1) << 2) | (((g5 >> bit) & 1) << 1)
+					     | ((b5 >> bit) & 1);
+	    if (nodos[x].hijo[i] == -1){
+		int y = nuevo(nivel + 1);
+		nodos[x].hijo[i] = y;
+	    }
+
+	    x = nodos[x].hijo[i];
+	    nodos[x].celda.suma(h.celda);
+	}
+    }
+
+    // Unimos las hojas, empezando por los nodos más profundos y, dentro de
+    // cada nivel, por los menos poblados.
+    int nhojas = static_cast<int>(hs.size());
+
+    for (int nivel = nbits - 1; nivel >= 0 and nhojas > ncolores; --nivel){
+	std::vector<int> candidatos;
+	for (int x = 0; x < static_cast<int>(nodos.size()); ++x)
+	    if (nodos[x].nivel == nivel and !nodos[x].hoja)
+		candidatos.push_back(x);
+
+	std::sort(candidatos.begin(), candidatos.end(), [&](int x, int y){
+		return nodos[x].celda.n < nodos[y].celda.n;});
+
+	for (int x: candidatos){
+	    int nhijos = static_cast<int>(std::count_if(nodos[x].hijo.begin(),
+					    nodos[x].hijo.end(),
+					    [](int h){return h != -1;}));
+	    nodos[x].hoja = true;
+	    nhojas -= nhijos - 1;
+
+	    if (nhojas <= ncolores)
+		break;
+	}
+    }
+
+    // Las hojas (accesibles desde la raíz) forman la paleta
+    Paleta res;
+    std::vector<int> pila{0};
+    while (!pila.empty()){
+	int x = pila.back();
+	pila.pop_back();
+
+	if (nodos[x].hoja)
+	    res.push_back(nodos[x].celda.media());
+	else
+	    for (int h: nodos[x].hijo)
+		if (h != -1)
+		    pila.push_back(h);
+    }
+
+    return res;
+}
+
+
+Paleta paleta_octree(const Image& img0, int ncolores)
+{ return octree(histograma(img0), ncolores); }
+
+Paleta paleta_octree(const Subimage& img0, int ncolores)
+{ return octree(histograma(img0), ncolores); }
+
+
+
+/***************************************************************************
+ *			    TABLA_PALETA
+ ***************************************************************************/
+Tabla_paleta::Tabla_paleta(const Paleta& paleta)
+    : paleta_(paleta), tabla_(32 * 32 * 32)
+{
+    parallel_for(32, [&](Ind r0, Ind re){
+	for (int r5 = r0; r5 < re; ++r5)
+	for (int g5 = 0; g5 < 32; ++g5)
+	for (int b5 = 0; b5 < 32; ++b5){
+	    int r = (r5 << 3) + 4;
+	    int g = (g5 << 3) + 4;
+	    int b = (b5 << 3) + 4;
+
+	    int mejor = 0;
+	    int dmin = -1;
+	    for (int k = 0; k < static_cast<int>(paleta_.size()); ++k){
+		int dr = paleta_[k].r - r;
+		int dg = paleta_[k].g - g;
+		int db = paleta_[k].b - b;
+		int d = dr*dr + dg*dg + db*db;
+		if (dmin == -1 or d < dmin){
+		    dmin = d;
+		    mejor = k;
+		}
+	    }
+
+	    tabla_[(r5 << 10) | (g5 << 5) | b5] = static_cast<std::uint8_t>(mejor);
+	}
+    }, 32 * 32 * static_cast<Ind>(paleta_.size()));
+}
+
+
+
+/***************************************************************************
+ *			    INDEXA
+ ***************************************************************************/
+static constexpr int bayer[8][8] = {
+    { 0, 32,  8, 40,  2, 34, 10, 42},
+    {48, 16, 56, 24, 50, 18, 58, 26},
+    {12, 44,  4, 36, 14, 46,  6, 38},
+    {60, 28, 52, 20, 62, 30, 54, 22},
+    { 3, 35, 11, 43,  1, 33,  9, 41},
+    {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47,  7, 39, 13, 45,  5, 37},
+    {63, 31, 55, 23, 61, 29, 53, 21}};
+
+
+template <typename Img>
+static void indexa_ordenado(const Img& img0, const Tabla_paleta& t,
+			    Plane<std::uint8_t>& res)
+{
+    Ind cols = img0.cols();
+
+    // Amplitud del ruido: distancia aproximada entre colores de la paleta
+    int A = static_cast<int>(256.0 / std::cbrt(static_cast<double>(t.size())));
+
+    parallel_for(img0.rows(), [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i){
+	    const ColorRGB* p = &img0(i, 0);
+	    std::uint8_t* q = &res(i, 0);
+
+	    for (Ind j = 0; j < cols; ++j){
+		int d = ((2 * bayer[i & 7][j & 7] + 1 - 64) * A) / 128;
+		q[j] = t(ColorRGB{p[j].r + d, p[j].g + d, p[j].b + d});
+	    }
+	}
+    }, cols);
+}
+
+
+// Floyd-Steinberg. El error de cada pixel se reparte entre sus vecinos:
+//	      x   7
+//	  3   5   1	    (/16)
+template <typename Img>
+static void indexa_difusion(const Img& img0, const Tabla_paleta& t,
+			    Plane<std::uint8_t>& res)
+{
+    Ind rows = img0.rows();
+    Ind cols = img0.cols();
+
+    // Errores (x 16) de la fila actual y de la siguiente, con un pixel más
+    // a cada lado para no comprobar los bordes.
+    std::vector<std::array<int, 3>> e0(cols + 2, {0, 0, 0});
+    std::vector<std::array<int, 3>> e1(cols + 2, {0, 0, 0});
+
+    for (Ind i = 0; i < rows; ++i){
+	const ColorRGB* p = &img0(i, 0);
+	std::uint8_t* q = &res(i, 0);
+
+	for (Ind j = 0; j < cols; ++j){
+	    const auto& e = e0[j + 1];
+	    ColorRGB c{a_8bits(p[j].r + e[0] / 16),
+		       a_8bits(p[j].g + e[1] / 16),
+		       a_8bits(p[j].b + e[2] / 16)};
+
+	    q[j] = t(c);
+	    const ColorRGB& x = t.color(q[j]);
+	    int err[3] = {c.r - x.r, c.g - x.g, c.b - x.b};
+
+	    for (int k = 0; k < 3; ++k){
+		e0[j + 2][k] += 7 * err[k];
+		e1[j    ][k] += 3 * err[k];
+		e1[j + 1][k] += 5 * err[k];
+		e1[j + 2][k] += 1 * err[k];
+	    }
+	}
+
+	std::swap(e0, e1);
+	std::fill(e1.begin(), e1.end(), std::array<int, 3>{0, 0, 0});
+    }
+}
+
+
+template <typename Img>
+static Plane<std::uint8_t> indexa_(const Img& img0, const Paleta& paleta,
+							    Tramado tramado)
+{
+    Ind rows = img0.rows();
+    Ind cols = img0.cols();
+    Plane<std::uint8_t> res{rows, cols};
+
+    if (rows == 0 or cols == 0)
+	return res;
+
+    Tabla_paleta t{paleta};
+
+    switch (tramado){
+	case Tramado::ninguno:
+	    parallel_for(rows, [&](Ind i0, Ind ie){
+		for (Ind i = i0; i < ie; ++i){
+		    const ColorRGB* p = &img0(i, 0);
+		    std::uint8_t* q = &res(i, 0);
+		    for (Ind j = 0; j < cols; ++j)
+			q[j] = t(p[j]);
+		}
+	    }, cols);
+	    break;
+
+	case Tramado::ordenado:
+	    indexa_ordenado(img0, t, res);
+	    break;
+
+	case Tramado::difusion:
+	    indexa_difusion(img0, t, res);
+	    break;
+    }
+
+    return res;
+}
+
+
+Plane<std::uint8_t> indexa(const Image& img0, const Paleta& paleta,
+							Tramado tramado)
+{ return indexa_(img0, paleta, tramado); }
+
+Plane<std::uint8_t> indexa(const Subimage& img0, const Paleta& paleta,
+							Tramado tramado)
+{ return indexa_(img0, paleta, tramado); }
+
+
+
+/***************************************************************************
+ *			    CUANTIZA
+ ***************************************************************************/
+template <typename Img>
+static Imagen_indexada cuantiza_(const Img& img0, int ncolores,
+			    Cuantizador cuantizador, Tramado tramado)
+{
+    Paleta paleta = (cuantizador == Cuantizador::median_cut)?
+				    paleta_median_cut(img0, ncolores):
+				    paleta_octree(img0, ncolores);
+
+    Plane<std::uint8_t> indices = indexa(img0, paleta, tramado);
+
+    return Imagen_indexada{std::move(paleta), std::move(indices)};
+}
+
+
+Imagen_indexada cuantiza(const Image& img0, int ncolores,
+			 Cuantizador cuantizador, Tramado tramado)
+{ return cuantiza_(img0, ncolores, cuantizador, tramado); }
+
+Imagen_indexada cuantiza(const Subimage& img0, int ncolores,
+			 Cuantizador cuantizador, Tramado tramado)
+{ return cuantiza_(img0, ncolores, cuantizador, tramado); }
+
+
+Image reconstruye(const Imagen_indexada& img0)
+{
+    Ind rows = img0.indices.rows();
+    Ind cols = img0.indices.cols();
+    Image res{rows, cols};
+
+    parallel_for(rows, [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i){
+	    const std::uint8_t* p = &img0.indices(i, 0);
+	    ColorRGB* q = &res(i, 0);
+	    for (Ind j = 0; j < cols; ++j)
+		q[j] = img0.paleta[p[j]];
+	}
+    }, cols);
+
+    return res;
+}
+
+
+}// namespace img
+
@@ -0,0 +1,147 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#ifndef __IMG_QUANTIZE_H__
+#define __IMG_QUANTIZE_H__
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Reducción del número de colores de una imagen
+ *	(cuantización).
+ *
+ *   - COMENTARIOS: Se calcula una paleta de como mucho 256 colores y se
+ *	sustituye cada pixel por el índice del color más parecido de la
+ *	paleta:
+ *
+ *	    Imagen_indexada res = cuantiza(img, 16);
+ *	    Image img1 = reconstruye(res);   // img con solo 16 colores
+ *
+ *	Hay dos formas de elegir la paleta:
+ *	    + median cut: se divide el cubo RGB en cajas, partiendo siempre
+ *	      la más grande por la mediana de su lado más largo.
+ *	    + octree: se meten los colores en un árbol (cada nivel usa un bit
+ *	      más de r, g y b) y se van uniendo las hojas menos pobladas.
+ *
+ *	Las dos trabajan sobre un histograma de 32 x 32 x 32 celdas (5 bits
+ *	por canal) que guarda también la suma de los colores de cada celda,
+ *	de tal manera que el coste no depende del tamaño de la imagen sino
+ *	del número de celdas ocupadas.
+ *
+ *	Para no buscar en toda la paleta el color más cercano de cada pixel,
+ *	Tabla_paleta precalcula el color más cercano al centro de cada una de
+ *	las 32 x 32 x 32 celdas.
+ *
+ *	Opcionalmente se puede tramar (dithering) al indexar: tramado
+ *	ordenado (Bayer 8 x 8) o difusión del error (Floyd-Steinberg).
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include <cstdint>
+#include <vector>
+
+#include "img_image.h"
+#include "img_color.h"
+#include "img_view.h"	// Subimage
+
+namespace img{
+
+using Paleta = std::vector<ColorRGB>;
+
+/// Imagen en la que cada pixel es el índice de su color en la paleta.
+struct Imagen_indexada{
+    Paleta paleta;
+    Plane<std::uint8_t> indices;
+};
+
+enum class Cuantizador {median_cut, octree};
+
+enum class Tramado {
+    ninguno,
+    ordenado,	// matriz de Bayer 8 x 8 (se paraleliza)
+    difusion	// Floyd-Steinberg (secuencial)
+};
+
+
+/// Paleta de como mucho ncolores (en [1, 256]) colores para img0.
+Paleta paleta_median_cut(const Image& img0, int ncolores = 256);
+Paleta paleta_median_cut(const Subimage& img0, int ncolores = 256);
+
+Paleta paleta_octree(const Image& img0, int ncolores = 256);
+Paleta paleta_octree(const Subimage& img0, int ncolores = 256);
+
+
+/*!
+ *  \brief  Busca el color más cercano de una paleta.
+ *
+ *  Es aproximado: devuelve el color de la paleta más cercano al centro de
+ *  la celda de 8 x 8 x 8 en la que cae el color.
+ *
+ */
+class Tabla_paleta{
+public:
+    /// precondición: 0 < paleta.size() <= 256
+    explicit Tabla_paleta(const Paleta& paleta);
+
+    /// Índice del color de la paleta más cercano a c.
+    std::uint8_t operator()(const ColorRGB& c) const
+    { return tabla_[celda(c)]; }
+
+    const ColorRGB& color(int k) const {return paleta_[k];}
+    int size() const {return static_cast<int>(paleta_.size());}
+
+private:
+    Paleta paleta_;
+    std::vector<std::uint8_t> tabla_;	// 32 x 32 x 32
+
+    static int canal(int x)
+    { return (x < 0? 0: (x > 255? 255: x)) >> 3; }
+
+    static int celda(const ColorRGB& c)
+    { return (canal(c.r) << 10) | (canal(c.g) << 5) | canal(c.b); }
+};
+
+
+/// Índices de la paleta que corresponden a cada pixel de img0.
+Plane<std::uint8_t> indexa(const Image& img0, const Paleta& paleta,
+				Tramado tramado = Tramado::ninguno);
+Plane<std::uint8_t> indexa(const Subimage& img0, const Paleta& paleta,
+				Tramado tramado = Tramado::ninguno);
+
+
+/// Calcula una paleta de ncolores para img0 e indexa la imagen.
+Imagen_indexada cuantiza(const Image& img0, int ncolores = 256,
+			 Cuantizador cuantizador = Cuantizador::median_cut,
+			 Tramado tramado = Tramado::ninguno);
+
+Imagen_indexada cuantiza(const Subimage& img0, int ncolores = 256,
+			 Cuantizador cuantizador = Cuantizador::median_cut,
+			 Tramado tramado = Tramado::ninguno);
+
+
+/// Imagen con los colores de la paleta.
+Image reconstruye(const Imagen_indexada& img0);
+
+
+}// namespace img
+
+#endif
+
@@ -0,0 +1,331 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#ifndef __IMG_SATURATE_H__
+#define __IMG_SATURATE_H__
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Devolver al cubo de color las imágenes calculadas.
+ *
+ *   - COMENTARIOS: Al operar con ColorRGB podemos acabar con colores que se
+ *	salen del cubo (canales < 0 ó > 255). Antes de guardar la imagen hay
+ *	que devolverlos al cubo:
+ *
+ *	    satura(img);	    // recorta cada canal a [0, 255]
+ *	    reescala(img);	    // lleva [min, max] a [0, 255]
+ *
+ *	o guardarla directamente saturando:
+ *
+ *	    write(img, "res.png", Fuera_de_rango::satura);
+ *
+ *	Las imágenes (Image y Subimage) se recorren por filas, con un
+ *	puntero, repartidas entre los hilos. Los bucles de cada fila no tienen
+ *	ningún if (el compilador los puede vectorizar).
+ *
+ *	También admiten vistas de un canal (imagen_red, ...) y planos.
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+
+#include "img_image.h"
+#include "img_color.h"
+#include "img_view.h"	// Filas_con_salto
+#include "img_parallel.h"
+
+namespace img{
+
+namespace impl_of{
+// Cubo de color: [color_min, color_max] en cada canal.
+inline constexpr int color_min = std::numeric_limits<Color>::min();
+inline constexpr int color_max = std::numeric_limits<Color>::max();
+
+template <typename Img>
+using Pixel_de_imagen = std::remove_cvref_t<decltype(std::declval<Img&>()(0, 0))>;
+
+template <typename Img>
+inline constexpr bool es_imagen_rgb = 
+		    std::is_same_v<Pixel_de_imagen<Img>, ColorRGB>;
+
+inline void satura_fila(ColorRGB* p, Ind n)
+{
+    for (Ind j = 0; j < n; ++j){
+	p[j].r = std::clamp(p[j].r, color_min, color_max);
+	p[j].g = std::clamp(p[j].g, color_min, color_max);
+	p[j].b = std::clamp(p[j].b, color_min, color_max);
+    }
+}
+
+// Es !is_color(x) sin saltos.
+inline int fuera_de_rango(int x)
+{ return (x < color_min) + (x > color_max); }
+
+// Número de canales de la fila fuera del cubo de color.
+inline Ind fuera_de_rango_fila(const ColorRGB* p, Ind n)
+{
+    Ind res = 0;
+    for (Ind j = 0; j < n; ++j)
+	res += fuera_de_rango(p[j].r) + fuera_de_rango(p[j].g) +
+	       fuera_de_rango(p[j].b);
+
+    return res;
+}
+}// namespace impl_of
+
+
+/// ¿Están todos los pixeles de img0 dentro del cubo de color?
+/// Es is_color(c) aplicado a toda la imagen. Los hilos terminan en cuanto
+/// alguno encuentra un pixel fuera.
+template <typename Img>
+bool esta_en_rango(const Img& img0)
+{
+    Ind cols = img0.cols();
+    if (cols == 0)
+	return true;
+
+    std::atomic<bool> fuera{false};
+
+    parallel_for(img0.rows(), [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie and !fuera.load(std::memory_order_relaxed); ++i){
+	    if constexpr (impl_of::es_imagen_rgb<const Img>){
+		if (impl_of::fuera_de_rango_fila(&img0(i, 0), cols))
+		    fuera = true;
+	    }
+	    else if constexpr (Filas_con_salto<const Img>){
+		Ind n = 0;
+		para_cada(fila_con_salto(img0, i), [&n](int x)
+				    { n += impl_of::fuera_de_rango(x); });
+		if (n)
+		    fuera = true;
+	    }
+	    else{
+		for (Ind j = 0; j < cols; ++j)
+		    if (!is_color(img0(i, j)))
+			fuera = true;
+	    }
+	}
+    }, cols);
+
+    return !fuera;
+}
+
+
+/// Recorta cada canal de cada pixel de img0 a [0, 255].
+template <typename Img>
+void satura(Img&& img0)
+{
+    using impl_of::color_min;
+    using impl_of::color_max;
+
+    Ind cols = img0.cols();
+    if (cols == 0)
+	return;
+
+    parallel_for(img0.rows(), [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i){
+	    if constexpr (impl_of::es_imagen_rgb<Img>)
+		impl_of::satura_fila(&img0(i, 0), cols);
+	    else if constexpr (Filas_con_salto<std::remove_reference_t<Img>>)
+		para_cada(fila_con_salto(img0, i), [](auto& x)
+				{ x = std::clamp<int>(x, color_min, color_max); });
+	    else
+		for (Ind j = 0; j < cols; ++j)
+		    img0(i, j) = std::clamp<int>(img0(i, j), color_min,
+							     color_max);
+	}
+    }, cols);
+}
+
+
+
+/***************************************************************************
+ *			    MÍNIMO Y MÁXIMO
+ ***************************************************************************/
+/// Mínimo y máximo de cada canal.
+struct Rango_rgb{
+    ColorRGB min;
+    ColorRGB max;
+};
+
+
+namespace impl_of{
+inline void une(Rango_rgb& a, const Rango_rgb& b)
+{
+    a.min = ColorRGB{std::min(a.min.r, b.min.r), std::min(a.min.g, b.min.g),
+		     std::min(a.min.b, b.min.b)};
+    a.max = ColorRGB{std::max(a.max.r, b.max.r), std::max(a.max.g, b.max.g),
+		     std::max(a.max.b, b.max.b)};
+}
+
+inline void rango_fila(const ColorRGB* p, Ind n, Rango_rgb& res)
+{
+    int min_r = res.min.r, min_g = res.min.g, min_b = res.min.b;
+    int max_r = res.max.r, max_g = res.max.g, max_b = res.max.b;
+
+    for (Ind j = 0; j < n; ++j){
+	min_r = std::min(min_r, p[j].r);
+	min_g = std::min(min_g, p[j].g);
+	min_b = std::min(min_b, p[j].b);
+	max_r = std::max(max_r, p[j].r);
+	max_g = std::max(max_g, p[j].g);
+	max_b = std::max(max_b, p[j].b);
+    }
+
+    res.min = ColorRGB{min_r, min_g, min_b};
+    res.max = ColorRGB{max_r, max_g, max_b};
+}
+}// namespace impl_of
+
+
+/// Mínimo y máximo de cada canal de img0 (Image o Subimage).
+/// Si img0 está vacía devuelve min = INT_MAX, max = INT_MIN.
+template <typename Img>
+Rango_rgb rango(const Img& img0)
+{
+    constexpr int inf = std::numeric_limits<int>::max();
+    constexpr int minf = std::numeric_limits<int>::min();
+
+    Rango_rgb total{ColorRGB{inf, inf, inf}, ColorRGB{minf, minf, minf}};
+    Ind cols = img0.cols();
+    if (cols == 0)
+	return total;
+
+    std::mutex m;
+
+    parallel_for(img0.rows(), [&](Ind i0, Ind ie){
+	Rango_rgb res = {ColorRGB{inf, inf, inf}, ColorRGB{minf, minf, minf}};
+
+	for (Ind i = i0; i < ie; ++i)
+	    impl_of::rango_fila(&img0(i, 0), cols, res);
+
+	std::lock_guard<std::mutex> lock{m};
+	impl_of::une(total, res);
+    }, cols);
+
+    return total;
+}
+
+
+
+/***************************************************************************
+ *				REESCALA
+ ***************************************************************************/
+/// ¿Se reescala cada canal con su mínimo y máximo, o todos con el mínimo y
+/// máximo de toda la imagen (conservando el color)?
+enum class Reescalado{ global, por_canal };
+
+namespace impl_of{
+// Transformación lineal x -> a + (x - min) * (b - a) / (max - min),
+// redondeada y recortada a [a, b].
+//
+// Se opera en double: las diferencias de dos int (hasta 2^32) son exactas
+// y el error de la pendiente es despreciable frente al redondeo. En punto
+// fijo (o en int) se pierde precisión o se desborda para rangos grandes.
+// precondición: a0 <= b0 (si no, std::clamp recibiría hi < lo)
+struct Lineal{
+    double min = 0;
+    double a = 0;
+    double ancho = 0;	// b - a
+    double k = 0;	// (b - a) / (max - min)
+
+    Lineal(int min0, int max0, int a0, int b0)
+	: min{static_cast<double>(min0)}, a{static_cast<double>(a0)},
+	  ancho{static_cast<double>(b0) - a0}
+    {
+	if (max0 > min0)
+	    k = ancho / (static_cast<double>(max0) - min0);
+    }
+
+    int operator()(int x) const
+    {
+	double y = std::clamp((x - min) * k + 0.5, 0.0, ancho);
+	return static_cast<int>(a + static_cast<std::int64_t>(y));
+    }
+};
+
+inline void reescala_fila(ColorRGB* p, Ind n, 
+			  const Lineal& fr, const Lineal& fg, const Lineal& fb)
+{
+    for (Ind j = 0; j < n; ++j){
+	p[j].r = fr(p[j].r);
+	p[j].g = fg(p[j].g);
+	p[j].b = fb(p[j].b);
+    }
+}
+}// namespace impl_of
+
+
+/****************************************************************************
+ *
+ *   - FUNCIÓN: reescala
+ *
+ *   - DESCRIPCIÓN: Transforma linealmente los valores de img0 de tal manera
+ *	que el mínimo pase a ser a y el máximo b (normalización min/max).
+ *	Si todos los valores son iguales, los convierte en a.
+ *
+ *	Img = Image o Subimage.
+ *
+ *   - PRECONDICIÓN: a <= b. Si no se cumple lanza std::logic_error.
+ *
+ ****************************************************************************/
+template <typename Img>
+void reescala(Img&& img0, Reescalado modo = Reescalado::global,
+	      int a = std::numeric_limits<Color>::min(),
+	      int b = std::numeric_limits<Color>::max())
+{
+    if (a > b)
+	throw std::logic_error{"reescala: el rango [a, b] está vacío (a > b)"};
+
+    Ind cols = img0.cols();
+    if (cols == 0 or img0.rows() == 0)
+	return;
+
+    Rango_rgb r = rango(img0);
+
+    if (modo == Reescalado::global){
+	int min = std::min({r.min.r, r.min.g, r.min.b});
+	int max = std::max({r.max.r, r.max.g, r.max.b});
+	r = Rango_rgb{ColorRGB{min, min, min}, ColorRGB{max, max, max}};
+    }
+
+    impl_of::Lineal fr{r.min.r, r.max.r, a, b};
+    impl_of::Lineal fg{r.min.g, r.max.g, a, b};
+    impl_of::Lineal fb{r.min.b, r.max.b, a, b};
+
+    parallel_for(img0.rows(), [&](Ind i0, Ind ie){
+	for (Ind i = i0; i < ie; ++i)
+	    impl_of::reescala_fila(&img0(i, 0), cols, fr, fg, fb);
+    }, cols);
+}
+
+
+}// namespace img
+
+#endif
+
@@ -0,0 +1,268 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#ifndef __IMG_STENCIL_H__
+#define __IMG_STENCIL_H__
+/****************************************************************************
+ *
+ *   - DESCRIPCION: Recorrido de una imagen con una ventana de k x k pixeles
+ *	(k = 2 * radio + 1) centrada en cada pixel.
+ *
+ *   - COMENTARIOS: Es el recorrido que comparten los filtros de mediana,
+ *	la morfología (erosión, dilatación), Sobel, ...:
+ *
+ *	    para_cada_vecindad(img0, 1, [&](const Vecindad<const int>& v){
+ *		res(v.posicion()) = v(-1, 0) + v(0, -1) - 4 * v(0, 0) 
+ *				  + v(0, 1) + v(1, 0);
+ *	    });
+ *
+ *	La ventana no calcula la posición de sus vecinos con img(i, j):
+ *	guarda un puntero al centro y el salto entre filas. fila(di) es un
+ *	puntero a la fila di de la ventana (se indexa con dj en [-radio,
+ *	radio]). Avanzar la ventana a la derecha es incrementar el puntero.
+ *
+ *	Admite Image, Subimage, las imágenes con borde (Image_con_borde_t)
+ *	y los contenedores con Filas_con_salto (Plane, vistas de un canal):
+ *	en estos la ventana guarda también el salto entre columnas, conocido
+ *	en tiempo de compilación (3 en una vista de un canal). Cualquier
+ *	otro contenedor no compila.
+ *
+ *	¿Qué pixeles se recorren?
+ *	    + Image_con_borde_t (con borde >= radio): todos. Los vecinos que
+ *	      se salen de la imagen los da el borde: el bucle no tiene que
+ *	      comprobar nada.
+ *	    + El resto: solo aquellos en los que la ventana cabe entera en
+ *	      la imagen (radio <= i < rows - radio, ídem j). Los bordes los
+ *	      tiene que tratar el que llama.
+ *
+ *	para_cada_vecindad reparte las filas en bandas entre los hilos. Para
+ *	repartirlas de otra forma se puede llamar a la versión que recorre
+ *	solo las filas [i0, ie).
+ *
+ *   - HISTORIA:
+ *    Manuel Perez
+ *	19/10/2026 Escrito
+ *
+ ****************************************************************************/
+#include <stdexcept>
+#include <type_traits>
+
+#include "img_image.h"
+#include "img_view.h"	// Filas_con_salto
+#include "img_padded.h"
+#include "img_parallel.h"
+
+namespace img{
+
+/*!
+ *  \brief  Ventana de (2 radio + 1) x (2 radio + 1) elementos T centrada en
+ *	    un pixel.
+ *
+ *  Los índices (di, dj) de los vecinos son relativos al centro:
+ *  -radio <= di, dj <= radio.
+ *
+ *  S es el salto entre dos columnas: 1 si las filas son contiguas, 3 en
+ *  una vista de un canal de una imagen.
+ *
+ */
+template <typename T, Ind S = 1>
+class Vecindad{
+public:
+    Vecindad(T* centro, Ind salto_fila, Ind radio, Position p)
+	: p_{centro}, salto_{salto_fila}, radio_{radio}, pos_{p} {}
+
+    Ind radio() const {return radio_;}
+
+    /// Número de pixeles de cada lado de la ventana (= 2 radio + 1).
+    Ind lado() const {return 2 * radio_ + 1;}
+
+    /// Posición del centro en la imagen.
+    Position posicion() const {return pos_;}
+
+    /// Puntero a la fila di de la ventana, apuntando a la columna del
+    /// centro: fila(di)[dj] es el vecino (di, dj). Solo si las filas son
+    /// contiguas.
+    T* fila(Ind di) const requires (S == 1) {return p_ + di * salto_;}
+
+    T& operator()(Ind di, Ind dj) const {return p_[di * salto_ + dj * S];}
+
+    T& centro() const {return *p_;}
+
+    /// Número de elementos entre dos filas consecutivas.
+    Ind salto_fila() const {return salto_;}
+
+    /// Número de elementos entre dos columnas consecutivas.
+    static constexpr Ind salto_columna() {return S;}
+
+    /// Mueve la ventana un pixel a la derecha.
+    Vecindad& operator++()
+    {
+	p_ += S;
+	++pos_.j;
+	return *this;
+    }
+
+private:
+    T* p_;	    // centro
+    Ind salto_;
+    Ind radio_;
+    Position pos_;
+};
+
+
+namespace impl_of{
+// Cómo recorrer img0 con ventanas de radio dado: puntero a la posición
+// (0, 0), salto entre filas, salto S entre columnas y zona
+// [i0, ie) x [j0, je) de los centros.
+template <typename T, Ind S = 1>
+struct Recorrido_vecindad{
+    using Ventana = Vecindad<T, S>;
+
+    T* origen;
+    Ind salto;
+    Ind i0, ie, j0, je;
+
+    T* puntero(Ind i, Ind j) const {return origen + i * salto + j * S;}
+};
+
+
+template <typename T>
+void comprueba_borde(const Image_con_borde_t<T>& img0, Ind radio)
+{
+    if (radio < 0 or img0.borde() < radio)
+	throw std::logic_error{"para_cada_vecindad: el borde de la imagen "
+			       "es menor que el radio de la ventana"};
+}
+
+template <typename T>
+Recorrido_vecindad<T> recorrido_vecindad(Image_con_borde_t<T>& img0, Ind radio)
+{
+    comprueba_borde(img0, radio);
+    return {img0.fila(0), img0.salto_fila(), 0, img0.rows(), 0, img0.cols()};
+}
+
+template <typename T>
+Recorrido_vecindad<const T> 
+	    recorrido_vecindad(const Image_con_borde_t<T>& img0, Ind radio)
+{
+    comprueba_borde(img0, radio);
+    return {img0.fila(0), img0.salto_fila(), 0, img0.rows(), 0, img0.cols()};
+}
+
+
+template <typename Img>
+inline constexpr bool es_imagen_o_subimagen = 
+	es_uno_de<std::remove_const_t<Img>, Image, Subimage, const_Subimage>;
+
+// Salto entre columnas de los contenedores que no tienen borde.
+template <typename Img>
+constexpr Ind salto_columna()
+{
+    if constexpr (es_imagen_o_subimagen<Img>)
+	return 1;
+    else
+	return img::salto_de_filas<std::remove_const_t<Img>>;
+}
+
+
+// Image, Subimage (filas contiguas) y Filas_con_salto (Plane, vistas de
+// un canal)
+template <typename Img>
+    requires (es_imagen_o_subimagen<Img> or Filas_con_salto<Img>)
+auto recorrido_vecindad(Img& img0, Ind radio)
+{
+    using T = std::remove_reference_t<decltype(img0(0, 0))>;
+    constexpr Ind S = salto_columna<Img>();
+    using Recorrido = Recorrido_vecindad<T, S>;
+
+    if (radio < 0)
+	throw std::logic_error{"para_cada_vecindad: radio negativo"};
+
+    Ind rows = img0.rows();
+    Ind cols = img0.cols();
+
+    // La ventana no cabe: no hay nada que recorrer
+    if (rows < 2 * radio + 1 or cols < 2 * radio + 1)
+	return Recorrido{nullptr, 0, 0, 0, 0, 0};
+
+    T* p = &img0(0, 0);
+    Ind salto = (rows > 1? static_cast<Ind>(&img0(1, 0) - p): cols * S);
+
+    return Recorrido{p, salto, radio, rows - radio, radio, cols - radio};
+}
+}// namespace impl_of
+
+
+
+/****************************************************************************
+ *
+ *   - FUNCIÓN: para_cada_vecindad
+ *
+ *   - DESCRIPCIÓN: Llama a f(v) para cada una de las ventanas v de radio
+ *	dado de img0 (Vecindad<T, S>, o Vecindad<const T, S> si img0 es
+ *	const; S es el salto entre columnas).
+ *	Se recorren por filas, de izquierda a derecha.
+ *
+ *	La primera versión recorre solo los centros de las filas [i0, ie)
+ *	(para repartir el trabajo a mano); la segunda reparte las filas
+ *	entre los hilos: f no puede escribir en img0 (los vecinos de una
+ *	banda pertenecen a otra) y tiene que poder llamarse desde varios
+ *	hilos a la vez.
+ *
+ ****************************************************************************/
+/// Contenedores que se pueden recorrer con para_cada_vecindad.
+template <typename Img>
+concept Con_vecindades = requires (Img& img0, Ind radio)
+{ impl_of::recorrido_vecindad(img0, radio); };
+
+
+template <Con_vecindades Img, typename F>
+void para_cada_vecindad(Img& img0, Ind radio, F f, Ind i0, Ind ie)
+{
+    auto r = impl_of::recorrido_vecindad(img0, radio);
+    using Ventana = typename decltype(r)::Ventana;
+
+    i0 = std::max(i0, r.i0);
+    ie = std::min(ie, r.ie);
+
+    for (Ind i = i0; i < ie; ++i){
+	Ventana v{r.puntero(i, r.j0), r.salto, radio, Position{i, r.j0}};
+	for (Ind j = r.j0; j < r.je; ++j, ++v)
+	    f(v);
+    }
+}
+
+
+template <Con_vecindades Img, typename F>
+void para_cada_vecindad(Img& img0, Ind radio, F f)
+{
+    auto r = impl_of::recorrido_vecindad(img0, radio);
+    Ind lado = 2 * radio + 1;
+
+    parallel_for(r.ie - r.i0, [&](Ind i0, Ind ie){
+	para_cada_vecindad(img0, radio, f, r.i0 + i0, r.i0 + ie);
+    }, (r.je - r.j0) * lado * lado);
+}
+
+
+}// namespace img
+
+#endif
+
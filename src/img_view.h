@@ -28,6 +28,8 @@
  *	26/07/2020 Cambio interfaz de Image_xy. Era raro...
  *	28/11/2020 Migro Image_xy a alp.
  *	01/09/2022 Image_as_array
+ *	19/10/2026 Image_as_array sin divisiones. const_Image_as_array.
+ *		   Filas con salto.
  *
  ****************************************************************************/
 #include <alp_concepts.h>
@@ -38,6 +40,12 @@
 #include <alp_type_traits.h>
 #include <alp_rframe_xy.h>
 
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <type_traits>
+
 #include "img_image.h"	// Rectangulo
 #include "img_color.h"	// Color_red...
 
@@ -209,6 +217,20 @@ public:
     Radio r_max() const {return img_.x_max();}
 
 
+    /// Imagen sobre la que hemos colocado la máscara
+    Image& image() {return img_.matrix();}
+
+    /// Posición (i, j) en la imagen del punto de coordenadas cartesianas
+    /// (x, y). Se trunca igual que en operator().
+    Position posicion(double x, double y) const
+    {
+	return img_.posicion(Image_xy::Point{static_cast<Ind_xy>(x),
+					     static_cast<Ind_xy>(y)});
+    }
+
+    /// Posición (i, j) en la imagen del origen (r = 0).
+    Position centro() const {return posicion(0.0, 0.0);}
+
     /// Número de filas
     Image_xy::Ind rows() const {return img_.rows();}
 
@@ -239,68 +261,433 @@ private:
 /***************************************************************************
  *			    Image_as_array
  ***************************************************************************/
+/*!
+ *  \brief  Vemos una imagen como un array de int: r0, g0, b0, r1, g1, ...
+ *
+ *  Para que los algoritmos numéricos puedan operar con la imagen como si
+ *  fuera un array.
+ *
+ *  Cada fila de la imagen está contigua en memoria y ColorRGB son 3 int
+ *  consecutivos, así que cada fila es un array de 3 * cols int. Si la
+ *  imagen es densa (Image: las filas están una detrás de otra) toda la
+ *  imagen es un único array: operator[] y los iteradores (punteros) no
+ *  hacen ninguna división y se puede obtener el span de toda la imagen.
+ *
+ *  Con una Subimage las filas no están seguidas: operator[] hace una
+ *  división para localizar la fila. Los iteradores (Iterador_con_salto)
+ *  guardan el principio de la fila y la posición dentro de ella: avanzar
+ *  no divide. Saltar n posiciones (it + n) sí.
+ *
+ *  Ver los ColorRGB como un array de int (reinterpret_cast) no lo define
+ *  el estándar: depende de que el compilador no meta relleno entre los
+ *  3 int de ColorRGB ni entre dos ColorRGB. Los static_assert comprueban
+ *  que es así.
+ *
+ */
+namespace impl_of{
+// Iterador de los int de una imagen cuyas filas no están seguidas:
+// rows filas de cols int, separadas salto int.
+// El final es la posición (rows - 1, cols): no nos salimos del array.
+template <typename Int>
+class Iterador_con_salto{
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using iterator_concept  = std::random_access_iterator_tag;
+    using value_type	    = std::remove_const_t<Int>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer	    = Int*;
+    using reference	    = Int&;
+
+    Iterador_con_salto() = default;
+
+    Iterador_con_salto(Int* fila, difference_type i, difference_type j,
+		       difference_type rows, difference_type cols,
+		       difference_type salto)
+	: fila_{fila}, i_{i}, j_{j}, rows_{rows}, cols_{cols}, salto_{salto}
+    { }
+
+    reference operator*() const {return fila_[j_];}
+    pointer operator->() const {return fila_ + j_;}
+
+    reference operator[](difference_type n) const {return *(*this + n);}
+
+    Iterador_con_salto& operator++()
+    {
+	if (++j_ == cols_ and i_ + 1 < rows_){
+	    j_ = 0;
+	    ++i_;
+	    fila_ += salto_;
+	}
+	return *this;
+    }
+
+    Iterador_con_salto operator++(int)
+    { auto tmp = *this; ++*this; return tmp; }
+
+    Iterador_con_salto& operator--()
+    {
+	if (j_ == 0){
+	    j_ = cols_;
+	    --i_;
+	    fila_ -= salto_;
+	}
+	--j_;
+	return *this;
+    }
+
+    Iterador_con_salto operator--(int)
+    { auto tmp = *this; --*this; return tmp; }
+
+    Iterador_con_salto& operator+=(difference_type n)
+    {
+	if (n == 0)
+	    return *this;
+
+	difference_type k = indice() + n;
+	difference_type i = (k == rows_ * cols_? rows_ - 1: k / cols_);
+
+	fila_ += (i - i_) * salto_;
+	i_ = i;
+	j_ = k - i * cols_;
+	return *this;
+    }
+
+    Iterador_con_salto& operator-=(difference_type n) {return *this += -n;}
+
+    friend Iterador_con_salto operator+(Iterador_con_salto it, 
+							difference_type n)
+    { return it += n; }
+
+    friend Iterador_con_salto operator+(difference_type n, 
+							Iterador_con_salto it)
+    { return it += n; }
+
+    friend Iterador_con_salto operator-(Iterador_con_salto it, 
+							difference_type n)
+    { return it -= n; }
+
+    friend difference_type operator-(const Iterador_con_salto& a,
+				     const Iterador_con_salto& b)
+    { return a.indice() - b.indice(); }
+
+    friend bool operator==(const Iterador_con_salto& a,
+			   const Iterador_con_salto& b)
+    { return a.indice() == b.indice(); }
+
+    friend std::strong_ordering operator<=>(const Iterador_con_salto& a,
+					    const Iterador_con_salto& b)
+    { return a.indice() <=> b.indice(); }
+
+private:
+    Int* fila_ = nullptr;	// principio de la fila i_
+    difference_type i_ = 0, j_ = 0;
+    difference_type rows_ = 0, cols_ = 0, salto_ = 0;
+
+    difference_type indice() const {return i_ * cols_ + j_;}
+};
+}// namespace impl_of
+
+
 template <typename Image_type>
 class Image_as_array_base{
 public:
+    /// ¿Las filas están una detrás de otra?
+    static constexpr bool es_densa = 
+		    std::is_same_v<std::remove_const_t<Image_type>, Image>;
+
     using size_type = Image_type::size_type;
+    using value_type= int;
+    using Int	    = alp::Same_const_as<int, Image_type>;
+    using iterator  = std::conditional_t<es_densa, Int*, 
+				      impl_of::Iterador_con_salto<Int>>;
+    using const_iterator = std::conditional_t<es_densa, const int*,
+				      impl_of::Iterador_con_salto<const int>>;
+
     static constexpr int ncolors = Image_type::value_type::ncolors;
-    static_assert(ncolors == 3); // usamos que son r, g, b en operator()
+    static_assert(ncolors == 3); // usamos que son r, g, b
+
+    // Usamos que un ColorRGB son 3 int seguidos
+    static_assert(std::is_standard_layout_v<ColorRGB> and
+		  sizeof(ColorRGB) == ncolors * sizeof(int));
+
+    Image_as_array_base(Image_type& img0);
 
-    Image_as_array_base(Image_type& img0) : img_{img0} { }
+    size_type size() const { return rows_ * cols_;}
 
-    size_type size() const { return img_.size() * ncolors;}
+    /// Número de filas de la imagen.
+    size_type rows() const { return rows_;}
 
-    alp::Same_const_as<int, Image_type>& operator[](size_type n);
-    const int& operator[](size_type n) const;
+    /// Número de int de cada fila (= 3 * número de columnas de la imagen)
+    size_type tam_fila() const { return cols_;}
+
+    Int& operator[](size_type n) { return data_[indice(n)]; }
+    const int& operator[](size_type n) const { return data_[indice(n)]; }
+
+    /// Fila i de la imagen: 3 * cols int
+    std::span<Int> fila(size_type i)
+    { return std::span<Int>{data_ + i * salto_, static_cast<size_t>(cols_)}; }
+
+    std::span<const int> fila(size_type i) const
+    { return std::span<const int>{data_ + i * salto_, 
+						static_cast<size_t>(cols_)}; }
+
+
+    iterator begin() { return principio<iterator>(); }
+    iterator end() { return fin<iterator>(); }
+
+    const_iterator begin() const { return principio<const_iterator>(); }
+    const_iterator end() const { return fin<const_iterator>(); }
+
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+
+    // Solo imágenes densas
+    // --------------------
+    Int* data() requires es_densa { return data_; }
+    const int* data() const requires es_densa { return data_; }
+
+    /// Toda la imagen como un único array.
+    std::span<Int> span() requires es_densa 
+    { return std::span<Int>{data_, static_cast<size_t>(size())}; }
+
+    std::span<const int> span() const requires es_densa 
+    { return std::span<const int>{data_, static_cast<size_t>(size())}; }
 
 private:
-    Image_type& img_;
+    Int* data_;		// primer int de la fila 0
+    size_type rows_;
+    size_type cols_;	// int de cada fila
+    size_type salto_;	// int entre el principio de dos filas
+
+    template <typename It>
+    It principio() const
+    {
+	if constexpr (es_densa)
+	    return data_;
+	else
+	    return It{data_, 0, 0, rows_, cols_, salto_};
+    }
+
+    template <typename It>
+    It fin() const
+    {
+	if constexpr (es_densa)
+	    return data_ + size();
+	else if (rows_ == 0)
+	    return principio<It>();
+	else
+	    return It{data_ + (rows_ - 1) * salto_, rows_ - 1, cols_, 
+						    rows_, cols_, salto_};
+    }
+
+    size_type indice(size_type n) const
+    {
+	if constexpr (es_densa)
+	    return n;
+
+	else{
+	    size_type i = n / cols_;
+	    return i * salto_ + (n - i * cols_);
+	}
+    }
 };
 
 
 template <typename Image_type>
-alp::Same_const_as<int, Image_type>& 
-Image_as_array_base<Image_type>::operator[](size_type n)
+Image_as_array_base<Image_type>::Image_as_array_base(Image_type& img0)
+    : data_{nullptr}, rows_{img0.rows()}, cols_{ncolors * img0.cols()},
+      salto_{cols_}
 {
-    size_type cols_x_i_plus_j = n / 3; // cols*i + j
-    size_type c = n - 3*cols_x_i_plus_j;
-    size_type i = cols_x_i_plus_j / img_.cols();
-    size_type j = cols_x_i_plus_j - i * img_.cols();
-
-    switch (c){
-	break; case 0: return img_(i, j).r;
-	break; case 1: return img_(i, j).g;
-	break; case 2: return img_(i, j).b;
+    if (rows_ == 0 or cols_ == 0){
+	rows_ = 0;
+	return;
     }
 
-    throw std::logic_error{
-        "Image_as_array_base::operator[]: what I am doing here?"};
+    data_ = reinterpret_cast<Int*>(&img0(0, 0));
+
+    if constexpr (!es_densa){
+	if (rows_ > 1)
+	    salto_ = static_cast<size_type>(&img0(1, 0) - &img0(0, 0)) * ncolors;
+    }
 }
 
 
-template <typename Image_type>
-const int& 
-Image_as_array_base<Image_type>::operator[](size_type n) const
+using Image_as_array       = Image_as_array_base<Image>;
+using const_Image_as_array = Image_as_array_base<const Image>;
+
+
+
+
+/***************************************************************************
+ *			    FILAS CON SALTO
+ ***************************************************************************/
+/*!
+ *  \brief  Fila de una imagen de números vista como puntero + salto.
+ *
+ *  Las vistas de un canal (imagen_red(img), ...) devuelven referencias a
+ *  los int de los ColorRGB: los elementos de una fila están en memoria
+ *  cada 3 int (en un Plane cada 1). Los algoritmos que recorren la vista
+ *  con img0(i, j) no lo saben y el compilador no puede vectorizar.
+ *  Con fila_con_salto(img0, i) obtenemos el puntero al primer elemento de
+ *  la fila, con el salto entre elementos conocido en tiempo de
+ *  compilación:
+ *
+ *	if constexpr (Filas_con_salto<Img>)
+ *	    para_cada(fila_con_salto(img0, i), [](int& x) { ... });
+ *
+ *  Solo tienen filas con salto los tipos que lo declaran en
+ *  salto_de_filas: los planos (y sus submatrices) y las vistas de un
+ *  canal que devuelven imagen_red, ..., const_imagen_blue sobre Image y
+ *  Subimage. El salto no se deduce de las direcciones: una vista
+ *  cualquiera que devuelva referencias no tiene por qué ser afín.
+ *
+ *  Recorrer un canal con salto 3 supone que ColorRGB son 3 int seguidos
+ *  sin relleno (lo mismo que Image_as_array): lo garantizan los
+ *  static_assert, pero el estándar no lo define.
+ *
+ */
+template <typename T, Ind S>
+class Fila_con_salto{
+public:
+    using value_type = std::remove_const_t<T>;
+
+    Fila_con_salto(T* p, Ind n) : p_{p}, n_{n} {}
+
+    Ind size() const {return n_;}
+
+    /// Distancia (en elementos T) entre dos elementos consecutivos.
+    static constexpr Ind salto() {return S;}
+
+    static constexpr bool es_contigua() {return S == 1;}
+
+    /// Primer elemento de la fila.
+    T* data() const {return p_;}
+
+    T& operator[](Ind j) const {return p_[j * S];}
+
+private:
+    T* p_;
+    Ind n_;
+};
+
+
+namespace impl_of{
+template <typename V, typename... Ts>
+inline constexpr bool es_uno_de = (std::is_same_v<V, Ts> or ...);
+
+// ¿Es V una vista de un canal de Base (de las que construye este
+// fichero)?
+template <typename V, typename Base>
+constexpr bool es_vista_de_canal_de()
+{
+    if (es_uno_de<V, decltype(imagen_red(std::declval<Base&>())),
+		     decltype(imagen_green(std::declval<Base&>())),
+		     decltype(imagen_blue(std::declval<Base&>()))>)
+	return true;
+
+    // Las const_imagen_xxx necesitan cbegin()
+    if constexpr (requires (Base& b){ b.cbegin(); })
+	return es_uno_de<V, decltype(const_imagen_red(std::declval<Base&>())),
+			    decltype(const_imagen_green(std::declval<Base&>())),
+			    decltype(const_imagen_blue(std::declval<Base&>()))>;
+    else
+	return false;
+}
+
+template <typename V>
+inline constexpr bool es_vista_de_canal = 
+	es_vista_de_canal_de<V, Image>() or es_vista_de_canal_de<V, Subimage>();
+
+template <typename V>
+inline constexpr bool es_plano = false;
+
+template <typename T>
+inline constexpr bool es_plano<Plane<T>> = std::is_arithmetic_v<T>;
+
+template <typename T>
+inline constexpr bool es_plano<alp::Submatrix<Plane<T>>> = 
+						    std::is_arithmetic_v<T>;
+
+template <typename T>
+inline constexpr bool es_plano<alp::Submatrix<const Plane<T>>> = 
+						    std::is_arithmetic_v<T>;
+
+template <typename V>
+constexpr Ind salto_de_filas()
 {
-    size_type cols_x_i_plus_j = n / 3; // cols*i + j
-    size_type c = n - 3*cols_x_i_plus_j;
-    size_type i = cols_x_i_plus_j / img_.cols();
-    size_type j = cols_x_i_plus_j - i * img_.cols();
-
-    switch (c){
-	break; case 0: return img_(i, j).r;
-	break; case 1: return img_(i, j).g;
-	break; case 2: return img_(i, j).b;
+    if constexpr (es_plano<V>)
+	return 1;
+
+    else if constexpr (es_vista_de_canal<V>){
+	static_assert(std::is_standard_layout_v<ColorRGB> and
+		      sizeof(ColorRGB) == 3 * sizeof(int));
+	return 3;
     }
 
-    throw std::logic_error{
-        "Image_as_array_base::operator[]: what I am doing here?"};
+    else
+	return 0;
 }
+}// namespace impl_of
+
+
+/// Salto (en elementos) entre dos elementos consecutivos de una fila de
+/// Img, o 0 si sus filas no se pueden ver como puntero + salto. Para
+/// añadir un contenedor basta con especializarlo:
+///	template <> inline constexpr Ind salto_de_filas<Mi_plano> = 1;
+template <typename Img>
+inline constexpr Ind salto_de_filas = impl_of::salto_de_filas<Img>();
+
 
+/// Contenedores bidimensionales de números cuyas filas podemos recorrer
+/// con puntero + salto: Plane<int>, imagen_red(img), ...
+template <typename Img>
+concept Filas_con_salto = (salto_de_filas<std::remove_const_t<Img>> > 0);
 
-using Image_as_array = Image_as_array_base<Image>;
-// No funciona bien const_Image_as_array. Si se descomenta probarlo.
-//using const_Image_as_array = Image_as_array_base<const Image>;
+
+/// Fila i de img0 como puntero + salto.
+/// precondición: 0 <= i < img0.rows()
+template <Filas_con_salto Img>
+auto fila_con_salto(Img& img0, Ind i)
+{
+    using T = std::remove_reference_t<decltype(img0(i, 0))>;
+    constexpr Ind S = salto_de_filas<std::remove_const_t<Img>>;
+
+    Ind n = img0.cols();
+    if (n == 0)
+	return Fila_con_salto<T, S>{nullptr, 0};
+
+    return Fila_con_salto<T, S>{&img0(i, 0), n};
+}
+
+
+/// Llama a f(x) para cada elemento x de la fila, en orden. El salto se
+/// conoce en tiempo de compilación: el bucle es vectorizable.
+template <typename T, Ind S, typename F>
+void para_cada(const Fila_con_salto<T, S>& fila, F f)
+{
+    T* p = fila.data();
+    Ind n = fila.size();
+
+    for (Ind j = 0; j < n; ++j)
+	f(p[j * S]);
+}
+
+
+/// Llama a f(x, y) para cada par de elementos x de a e y de b que ocupan
+/// la misma posición, en orden.
+/// precondición: a.size() == b.size()
+template <typename T1, Ind S1, typename T2, Ind S2, typename F>
+void para_cada(const Fila_con_salto<T1, S1>& a, 
+	       const Fila_con_salto<T2, S2>& b, F f)
+{
+    T1* p = a.data();
+    T2* q = b.data();
+    Ind n = a.size();
+
+    for (Ind j = 0; j < n; ++j)
+	f(p[j * S1], q[j * S2]);
+}
 
 
 }
@@ -0,0 +1,213 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "../../img_binary.h"
+#include "../../img_parallel.h"
+
+#include <alp_test.h>
+#include <alp_exception.h>
+
+#include <iostream>
+#include <sstream>
+#include <random>
+#include <cstdio>
+
+using namespace test;
+
+using img::ColorRGB;
+
+// Bandas horizontales de colores constantes
+static img::Image bandas(int rows, int cols)
+{
+    img::Image img0{rows, cols};
+    for (int i = 0; i < rows; ++i)
+	for (int j = 0; j < cols; ++j)
+	    img0(i, j) = ColorRGB{(j / 37) * 10 % 256, i % 3, 200};
+
+    return img0;
+}
+
+static img::Image ruido(int rows, int cols, int min, int max)
+{
+    std::mt19937 g{5};
+    std::uniform_int_distribution<int> d{min, max};
+
+    img::Image img0{rows, cols};
+    for (auto& p: img0)
+	p = ColorRGB{d(g), d(g), d(g)};
+
+    return img0;
+}
+
+// Escribe y lee img0 en memoria comprobando que se recupera la misma imagen.
+// Devuelve el tamaño en bytes.
+static std::size_t ida_y_vuelta(const img::Image& img0, img::Compresion comp,
+				const std::string& msg)
+{
+    std::stringstream str{std::ios::in | std::ios::out | std::ios::binary};
+    img::write_binario(img0, str, comp);
+    std::size_t n = str.str().size();
+
+    img::Image img1 = img::read_binario(str);
+    CHECK_TRUE(img1.size2D() == img0.size2D(), msg);
+    CHECK_EQUAL_CONTAINERS(img1.begin(), img1.end(), img0.begin(), img0.end(), msg);
+
+    return n;
+}
+
+template <typename F>
+static bool lanza_error_de_formato(F f)
+{
+    try{ f(); }
+    catch(const alp::Error_de_formato&) { return true; }
+
+    return false;
+}
+
+
+void test_ida_y_vuelta()
+{
+    test::interfaz("write_binario/read_binario");
+
+    // Todos los canales en [0, 255]: se guarda con 8 bits por canal
+    img::Image rgb8{123, 217};
+    for (int i = 0; i < 123; ++i)
+	for (int j = 0; j < 217; ++j)
+	    rgb8(i, j) = ColorRGB{(i * 7) % 256, (j * 3) % 256, (i + j) % 256};
+
+    for (auto comp: {img::Compresion::ninguna, img::Compresion::rle}){
+	std::string nombre = (comp == img::Compresion::rle? "(rle)": "");
+
+	ida_y_vuelta(rgb8, comp, "rgb8" + nombre);
+
+	// Fuera del cubo: se guarda con 32 bits por canal
+	img::Image img1 = ruido(50, 301, -1000, 100000);
+	ida_y_vuelta(img1, comp, "rgb32" + nombre);
+
+	img::Image img2 = bandas(40, 1000);
+	ida_y_vuelta(img2, comp, "bandas" + nombre);
+
+	// Ruido: el peor caso de la compresión
+	img::Image img3 = ruido(30, 777, 0, 1);
+	ida_y_vuelta(img3, comp, "ruido" + nombre);
+
+	img::Image img4{0, 0};
+	ida_y_vuelta(img4, comp, "vacía" + nombre);
+
+	img::Image img5{1, 1};
+	img5(0, 0) = ColorRGB{1, 2, 3};
+	ida_y_vuelta(img5, comp, "1 pixel" + nombre);
+    }
+
+    // Tamaños
+    CHECK_TRUE(ida_y_vuelta(rgb8, img::Compresion::ninguna, "rgb8")
+						    == 16 + 123 * 217 * 3, "rgb8(tamaño)");
+
+    img::Image img1 = ruido(10, 20, -5, 5);
+    CHECK_TRUE(ida_y_vuelta(img1, img::Compresion::ninguna, "rgb32")
+						    == 16 + 10 * 20 * 12, "rgb32(tamaño)");
+
+    img::Image img2 = bandas(100, 1000);
+    CHECK_TRUE(ida_y_vuelta(img2, img::Compresion::rle, "bandas(rle)")
+					    < 100 * 1000 * 3 / 20, "rle(tamaño)");
+
+    // Fichero
+    img::write_binario(rgb8, "prueba.imgb", img::Compresion::rle);
+    img::Image img3 = img::read_binario("prueba.imgb");
+    CHECK_TRUE(img3.size2D() == rgb8.size2D(), "fichero");
+    CHECK_EQUAL_CONTAINERS(img3.begin(), img3.end(), rgb8.begin(), rgb8.end(),
+			   "fichero");
+    std::remove("prueba.imgb");
+}
+
+
+void test_errores()
+{
+    test::interfaz("read_binario(errores)");
+
+    CHECK_TRUE(lanza_error_de_formato([]{
+		std::stringstream str{"(000, 001, 002) (003, 004, 005)"};
+		img::read_binario(str);}), "marca");
+
+    img::Image img0{10, 10};
+    for (auto& p: img0)
+	p = ColorRGB{1, 2, 3};
+
+    std::stringstream str{std::ios::in | std::ios::out | std::ios::binary};
+    img::write_binario(img0, str);
+    std::string datos = str.str();
+
+    CHECK_TRUE(lanza_error_de_formato([&]{
+		std::stringstream s2{datos.substr(0, datos.size() - 1)};
+		img::read_binario(s2);}), "faltan datos");
+
+    std::string d2 = datos;
+    d2[4] = 7;
+    CHECK_TRUE(lanza_error_de_formato([&]{
+		std::stringstream s2{d2};
+		img::read_binario(s2);}), "versión");
+
+    // rle con un bloque que se sale de la fila
+    std::stringstream str3{std::ios::in | std::ios::out | std::ios::binary};
+    img::write_binario(bandas(2, 100), str3, img::Compresion::rle);
+    std::string d3 = str3.str();
+    d3[16 + 4] = static_cast<char>(255);
+    CHECK_TRUE(lanza_error_de_formato([&]{
+		std::stringstream s2{d3};
+		img::read_binario(s2);}), "rle");
+
+    // Tamaños de la cabecera que no se pueden reservar
+    std::string d4 = datos;
+    d4[8] = d4[9] = d4[10] = static_cast<char>(255);	// rows = 2^24 - 1
+    d4[12] = d4[13] = static_cast<char>(255);		// cols = 65535
+    CHECK_TRUE(lanza_error_de_formato([&]{
+		std::stringstream s2{d4};
+		img::read_binario(s2);}), "tamaño");
+
+    // Tamaño razonable pero sin datos: se ve antes de reservar la imagen
+    std::string d5 = datos.substr(0, 16);
+    d5[8] = d5[12] = 0;
+    d5[9] = d5[13] = 16;				// 4096 x 4096
+    CHECK_TRUE(lanza_error_de_formato([&]{
+		std::stringstream s2{d5};
+		img::read_binario(s2);}), "tamaño(faltan datos)");
+
+    bool lanza = false;
+    try{ img::read_binario("no_existe.imgb"); }
+    catch(const alp::File_cant_read&) { lanza = true; }
+    CHECK_TRUE(lanza, "no existe");
+}
+
+
+int main()
+{
+try{
+
+    test::header("img_binary.h");
+    img::num_threads(4);
+
+    test_ida_y_vuelta();
+    test_errores();
+
+}catch(const std::exception& e){
+    std::cerr << e.what() << '\n';
+    return 1;
+}
+
+    return 0;
+}
@@ -0,0 +1,186 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "../../img_color_count.h"
+#include "../../img_parallel.h"
+
+#include <alp_test.h>
+
+#include <iostream>
+#include <algorithm>
+#include <map>
+#include <random>
+
+using namespace test;
+
+using img::ColorRGB;
+
+// Imagen con colores aleatorios elegidos entre n
+static img::Image aleatoria(int rows, int cols, int n, unsigned semilla)
+{
+    std::mt19937 g{semilla};
+    std::uniform_int_distribution<int> d{0, 255};
+
+    std::vector<ColorRGB> cs;
+    for (int k = 0; k < n; ++k)
+	cs.push_back(ColorRGB{d(g), d(g), d(g)});
+
+    std::uniform_int_distribution<int> e{0, n - 1};
+    img::Image img0{rows, cols};
+    for (auto& p: img0)
+	p = cs[std::min(e(g), e(g))];	// los primeros son más frecuentes
+
+    return img0;
+}
+
+// Las frecuencias calculadas con un std::map
+template <typename Img>
+static std::map<std::uint32_t, size_t> cuenta(const Img& img0)
+{
+    std::map<std::uint32_t, size_t> res;
+    for (int i = 0; i < img0.rows(); ++i)
+	for (int j = 0; j < img0.cols(); ++j)
+	    ++res[img::clave(img0(i, j))];
+
+    return res;
+}
+
+
+void test_clave()
+{
+    test::interfaz("clave");
+
+    CHECK_TRUE(img::clave(ColorRGB{0x12, 0x34, 0x56}) == 0x123456, "clave");
+    CHECK_TRUE(img::clave(ColorRGB{-3, 300, 255}) == 0x00FFFF, "clave(recorta)");
+    CHECK_TRUE(img::color_de_clave(0xA0B0C0) == (ColorRGB{0xA0, 0xB0, 0xC0}),
+	       "color_de_clave");
+
+    // Ordenar por clave es ordenar por r, luego g y luego b
+    CHECK_TRUE(img::clave(ColorRGB{1, 0, 0}) > img::clave(ColorRGB{0, 255, 255})
+	   and img::clave(ColorRGB{0, 1, 0}) > img::clave(ColorRGB{0, 0, 255}),
+	       "clave(orden)");
+}
+
+
+void test_presentes()
+{
+    test::interfaz("Colores_presentes");
+
+    img::Colores_presentes cs;
+    CHECK_TRUE(cs.size() == 0, "Colores_presentes()");
+
+    cs.inserta(ColorRGB{1, 2, 3});
+    cs.inserta(ColorRGB{1, 2, 3});
+    cs.inserta(ColorRGB{255, 255, 255});
+    cs.inserta(std::uint32_t{0});
+    CHECK_TRUE(cs.size() == 3 and cs.contiene(ColorRGB{1, 2, 3}) and
+	       !cs.contiene(ColorRGB{1, 2, 4}) and cs.contiene(ColorRGB{0, 0, 0}),
+	       "inserta");
+
+    img::Image img0 = aleatoria(300, 250, 1000, 1);
+    auto m = cuenta(img0);
+    CHECK_TRUE(img::num_colores(img0) == m.size(), "num_colores");
+
+    img::Subimage sb{img0, img::Position{10, 20}, img::Size2D{30, 40}};
+    CHECK_TRUE(img::num_colores(sb) == cuenta(sb).size(), "num_colores(Subimage)");
+
+    img::Image vacia{0, 0};
+    CHECK_TRUE(img::num_colores(vacia) == 0, "num_colores(vacía)");
+}
+
+
+void test_frecuencias()
+{
+    test::interfaz("frecuencias");
+
+    std::vector<std::uint32_t> v;
+    std::mt19937 g{7};
+    for (int k = 0; k < 200000; ++k)
+	v.push_back(g() & 0xFFFFFF);
+    std::vector<std::uint32_t> w = v;
+    img::ordena_claves(v);
+    std::sort(w.begin(), w.end());
+    CHECK_TRUE(v == w, "ordena_claves");
+
+    img::Image img0 = aleatoria(400, 300, 5000, 2);
+    auto m = cuenta(img0);
+    auto fs = img::frecuencias(img0);
+
+    bool ok = (fs.size() == m.size());
+    size_t k = 0;
+    for (auto [c, n]: m){
+	if (!ok)
+	    break;
+	ok = (img::clave(fs[k].color) == c and fs[k].n == n);
+	++k;
+    }
+    CHECK_TRUE(ok, "frecuencias");
+
+    img::Subimage sb{img0, img::Position{100, 50}, img::Size2D{60, 70}};
+    auto fsb = img::frecuencias(sb);
+    size_t total = 0;
+    for (const auto& f: fsb)
+	total += f.n;
+    CHECK_TRUE(total == 60 * 70 and fsb.size() == cuenta(sb).size(),
+	       "frecuencias(Subimage)");
+}
+
+
+void test_dominantes()
+{
+    test::interfaz("colores_dominantes");
+
+    img::Image img0 = aleatoria(300, 300, 300, 3);
+    auto m = cuenta(img0);
+
+    std::vector<std::pair<size_t, std::uint32_t>> v;
+    for (auto [c, n]: m)
+	v.push_back({n, c});
+    std::sort(v.begin(), v.end(), [](auto a, auto b){
+	    return a.first != b.first? a.first > b.first: a.second < b.second;});
+
+    auto ds = img::colores_dominantes(img0, 10);
+    bool ok = ds.size() == 10;
+    for (size_t k = 0; k < ds.size() and ok; ++k)
+	ok = (ds[k].n == v[k].first and img::clave(ds[k].color) == v[k].second);
+    CHECK_TRUE(ok, "colores_dominantes");
+
+    CHECK_TRUE(img::colores_dominantes(img0, 100000).size() == m.size(),
+	       "colores_dominantes(k > num_colores)");
+}
+
+
+int main()
+{
+try{
+
+    test::header("img_color_count.h");
+    img::num_threads(4);
+
+    test_clave();
+    test_presentes();
+    test_frecuencias();
+    test_dominantes();
+
+}catch(const std::exception& e){
+    std::cerr << e.what() << '\n';
+    return 1;
+}
+
+    return 0;
+}
@@ -0,0 +1,314 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "../../img_color_space.h"
+#include "../../img_view.h"
+
+#include <alp_test.h>
+
+#include <iostream>
+#include <cstdlib>
+#include <algorithm>
+
+using namespace test;
+
+using img::ColorRGB;
+
+static int dist(const ColorRGB& a, const ColorRGB& b)
+{
+    return std::max({std::abs(a.r - b.r), std::abs(a.g - b.g),
+		     std::abs(a.b - b.b)});
+}
+
+// Error medio al convertir de RGB a otro espacio con f y volver con g
+template <typename F, typename G>
+static double error_medio(F f, G g, int paso = 5)
+{
+    double err = 0;
+    int n = 0;
+    for (int r = 0; r < 256; r += paso)
+	for (int gg = 0; gg < 256; gg += paso)
+	    for (int b = 0; b < 256; b += paso){
+		ColorRGB c{r, gg, b};
+		err += dist(c, g(f(c)));
+		++n;
+	    }
+
+    return err / n;
+}
+
+// Máximo error al convertir de RGB a otro espacio con f y volver con g,
+// recorriendo el cubo RGB con paso 'paso'
+template <typename F, typename G>
+static int error_ida_y_vuelta(F f, G g, int paso = 5)
+{
+    int err = 0;
+    for (int r = 0; r < 256; r += paso)
+	for (int gg = 0; gg < 256; gg += paso)
+	    for (int b = 0; b < 256; b += paso){
+		ColorRGB c{r, gg, b};
+		err = std::max(err, dist(c, g(f(c))));
+	    }
+
+    return err;
+}
+
+
+void test_hsv()
+{
+    test::interfaz("hsv");
+
+    CHECK_TRUE((img::hsv(ColorRGB{255, 0, 0}) == img::ColorHSV{0, 255, 255}),
+	       "hsv(rojo)");
+    CHECK_TRUE((img::hsv(ColorRGB{0, 255, 0}) == img::ColorHSV{120, 255, 255}),
+	       "hsv(verde)");
+    CHECK_TRUE((img::hsv(ColorRGB{0, 0, 128}) == img::ColorHSV{240, 255, 128}),
+	       "hsv(azul)");
+    CHECK_TRUE((img::hsv(ColorRGB{255, 0, 255}) == img::ColorHSV{300, 255, 255}),
+	       "hsv(magenta)");
+    CHECK_TRUE((img::hsv(ColorRGB{90, 90, 90}) == img::ColorHSV{0, 0, 90}),
+	       "hsv(gris)");
+    CHECK_TRUE((img::hsv(ColorRGB{300, -4, 0}) == img::ColorHSV{0, 255, 255}),
+	       "hsv(fuera de rango)");
+
+    CHECK_TRUE((img::rgb(img::ColorHSV{60, 255, 255}) == ColorRGB{255, 255, 0}),
+	       "rgb(ColorHSV)");
+    CHECK_TRUE((img::rgb(img::ColorHSV{180, 0, 77}) == ColorRGB{77, 77, 77}),
+	       "rgb(ColorHSV)");
+
+    int err = error_ida_y_vuelta([](const ColorRGB& c){return img::hsv(c);},
+				 [](const img::ColorHSV& c){return img::rgb(c);});
+    CHECK_TRUE(err <= 3, "rgb(hsv(c))");
+}
+
+
+void test_hsl()
+{
+    test::interfaz("hsl");
+
+    CHECK_TRUE((img::hsl(ColorRGB{255, 0, 0}) == img::ColorHSL{0, 255, 128}),
+	       "hsl(rojo)");
+    CHECK_TRUE((img::hsl(ColorRGB{255, 255, 255}) == img::ColorHSL{0, 0, 255}),
+	       "hsl(blanco)");
+    CHECK_TRUE((img::hsl(ColorRGB{0, 128, 128}) == img::ColorHSL{180, 255, 64}),
+	       "hsl(verde azulado)");
+
+    CHECK_TRUE((img::rgb(img::ColorHSL{120, 255, 128}) == ColorRGB{1, 255, 1}),
+	       "rgb(ColorHSL)");
+    CHECK_TRUE((img::rgb(img::ColorHSL{0, 0, 200}) == ColorRGB{200, 200, 200}),
+	       "rgb(ColorHSL)");
+
+    int err = error_ida_y_vuelta([](const ColorRGB& c){return img::hsl(c);},
+				 [](const img::ColorHSL& c){return img::rgb(c);});
+    CHECK_TRUE(err <= 4, "rgb(hsl(c))");
+}
+
+
+void test_ycbcr()
+{
+    test::interfaz("ycbcr");
+    using img::Norma_ycbcr;
+
+    for (int x: {0, 1, 77, 128, 254, 255}){
+	CHECK_TRUE((img::ycbcr(ColorRGB{x, x, x}) == img::ColorYCbCr{x, 128, 128}),
+		   "ycbcr(gris)");
+	CHECK_TRUE((img::ycbcr(ColorRGB{x, x, x}, Norma_ycbcr::bt709)
+			== img::ColorYCbCr{x, 128, 128}), "ycbcr(gris, bt709)");
+    }
+
+    // Valores de la norma JPEG (BT.601, rango completo)
+    CHECK_TRUE((img::ycbcr(ColorRGB{255, 0, 0}) == img::ColorYCbCr{76, 85, 255}),
+	       "ycbcr(rojo)");
+    CHECK_TRUE((img::ycbcr(ColorRGB{0, 0, 255}) == img::ColorYCbCr{29, 255, 107}),
+	       "ycbcr(azul)");
+    CHECK_TRUE((img::ycbcr(ColorRGB{255, 0, 0}, Norma_ycbcr::bt709)
+			== img::ColorYCbCr{54, 99, 255}), "ycbcr(rojo, bt709)");
+
+    for (auto n: {Norma_ycbcr::bt601, Norma_ycbcr::bt709}){
+	int err = error_ida_y_vuelta(
+		    [n](const ColorRGB& c){return img::ycbcr(c, n);},
+		    [n](const img::ColorYCbCr& c){return img::rgb(c, n);});
+	CHECK_TRUE(err <= 2, "rgb(ycbcr(c))");
+    }
+}
+
+
+void test_lab()
+{
+    test::interfaz("lab");
+
+    CHECK_TRUE((img::lab(ColorRGB{255, 255, 255}) == img::ColorLab{255, 128, 128}),
+	       "lab(blanco)");
+    CHECK_TRUE((img::lab(ColorRGB{0, 0, 0}) == img::ColorLab{0, 128, 128}),
+	       "lab(negro)");
+    CHECK_TRUE((img::lab(ColorRGB{100, 100, 100}) == img::ColorLab{108, 128, 128}),
+	       "lab(gris)");
+
+    // rojo: L* = 53.24, a* = 80.09, b* = 67.20
+    CHECK_TRUE((img::lab(ColorRGB{255, 0, 0}) == img::ColorLab{136, 208, 195}),
+	       "lab(rojo)");
+
+    // Al codificar Lab en 8 bits se pierde precisión: en los colores muy
+    // saturados el error puede ser grande, pero en media es pequeño.
+    auto f = [](const ColorRGB& c){return img::lab(c);};
+    auto g = [](const img::ColorLab& c){return img::rgb(c);};
+    CHECK_TRUE(error_medio(f, g) < 2.0, "rgb(lab(c))");
+
+    for (int x = 0; x < 256; ++x)
+	if (dist(ColorRGB{x, x, x}, g(f(ColorRGB{x, x, x}))) > 1){
+	    CHECK_TRUE(false, "rgb(lab(gris))");
+	    break;
+	}
+}
+
+
+void test_imagen()
+{
+    test::interfaz("imagen_*");
+
+    // r y g recorren [0, 240) alrededor de b = 128: salen los 6 sectores
+    // del tono. En la diagonal, grises.
+    img::Image img0{120, 90};
+    for (int i = 0; i < 120; ++i)
+	for (int j = 0; j < 90; ++j)
+	    img0(i, j) = (i == j)? ColorRGB{2 * i, 2 * i, 2 * i}
+				 : ColorRGB{2 * i, (8 * j) / 3, 128};
+
+    auto iguales = [&](const auto& res, auto f){
+	for (int i = 0; i < img0.rows(); ++i)
+	    for (int j = 0; j < img0.cols(); ++j)
+		if (!(res(i, j) == f(img0(i, j))))
+		    return false;
+	return true;
+    };
+
+    img::ImageHSV hsv = img::imagen_hsv(img0);
+    CHECK_TRUE(iguales(hsv, [](const ColorRGB& c){return img::hsv(c);}),
+	       "imagen_hsv");
+
+    img::ImageYCbCr ycc = img::imagen_ycbcr(img0, img::Norma_ycbcr::bt709);
+    CHECK_TRUE(iguales(ycc, [](const ColorRGB& c){
+			    return img::ycbcr(c, img::Norma_ycbcr::bt709);}),
+	       "imagen_ycbcr");
+
+    img::Image img1 = img::imagen_rgb(img::imagen_hsl(img0));
+    CHECK_TRUE(iguales(img1, [](const ColorRGB& c){
+			    return img::rgb(img::hsl(c));}), "imagen_rgb");
+
+    img1 = img::imagen_rgb(ycc, img::Norma_ycbcr::bt709);
+    CHECK_TRUE(img1.rows() == 120 and img1.cols() == 90, "imagen_rgb(ycbcr)");
+
+    // planos
+    img::Planos p = img::planos_lab(img0);
+    img::ImageLab lab = img::imagen_lab(img0);
+    bool ok = true;
+    for (int i = 0; i < img0.rows(); ++i)
+	for (int j = 0; j < img0.cols(); ++j)
+	    if (!(lab(i, j) == img::ColorLab{p.c0(i, j), p.c1(i, j), p.c2(i, j)}))
+		ok = false;
+    CHECK_TRUE(ok, "planos_lab");
+
+    // Subimage
+    img::Subimage sb{img0, img::Position{10, 20}, img::Size2D{50, 40}};
+    img::Planos q = img::planos_ycbcr(sb);
+    CHECK_TRUE(q.c0.rows() == 50 and q.c0.cols() == 40, "planos_ycbcr(Subimage)");
+    CHECK_TRUE(q.c1(3, 4) == img::ycbcr(img0(13, 24)).cb, "planos_ycbcr(Subimage)");
+}
+
+
+void test_intensidad()
+{
+    test::interfaz("plano_intensidad");
+    using img::Pesos_gris;
+
+    // La división por multiplicación es exacta
+    bool ok = true;
+    for (int s = 0; s <= 765; ++s){
+	ColorRGB c{s / 3, (s + 1) / 3, (s + 2) / 3};
+	std::uint8_t q8;
+	std::uint16_t q16;
+	img::impl_of::fila_gris_iguales(&c, &q8, 1);
+	img::impl_of::fila_gris_iguales(&c, &q16, 1);
+	if (q8 != img::intensidad(c) or q16 != s * 257 / 3)
+	    ok = false;
+    }
+    CHECK_TRUE(ok, "intensidad");
+
+    // Ruido: todas las sumas r + g + b posibles
+    std::srand(11);
+    img::Image img0{97, 83};
+    for (auto& c: img0)
+	c = ColorRGB{std::rand() % 256, std::rand() % 256, std::rand() % 256};
+    img0(0, 0) = ColorRGB{300, -5, 255};    // fuera de rango: se recorta
+
+    auto g8 = img::plano_intensidad(img0);
+    ok = true;
+    for (int i = 0; i < img0.rows(); ++i)
+	for (int j = 0; j < img0.cols(); ++j)
+	    if (i + j > 0 and g8(i, j) != img::intensidad(img0(i, j)))
+		ok = false;
+    CHECK_TRUE(ok and g8(0, 0) == 170, "plano_intensidad");
+
+    auto y8 = img::plano_intensidad(img0, Pesos_gris::bt709);
+    auto y16 = img::plano_intensidad<std::uint16_t>(img0, Pesos_gris::bt601);
+    ok = true;
+    for (int i = 0; i < img0.rows(); ++i)
+	for (int j = 0; j < img0.cols(); ++j){
+	    if (y8(i, j) != img::ycbcr(img0(i, j), img::Norma_ycbcr::bt709).y)
+		ok = false;
+	    if (std::abs(y16(i, j) / 257.0 - img::ycbcr(img0(i, j)).y) > 0.5)
+		ok = false;
+	}
+    CHECK_TRUE(ok, "plano_intensidad(luma)");
+
+    img::Image blanco{2, 2};
+    blanco(0, 0) = blanco(0, 1) = blanco(1, 0) = blanco(1, 1) = ColorRGB{255, 255, 255};
+    CHECK_TRUE(img::plano_intensidad<std::uint16_t>(blanco)(1, 1) == 65535 and
+	       img::plano_intensidad<std::uint16_t>(blanco, Pesos_gris::bt709)(0, 1)
+								    == 65535,
+	       "plano_intensidad(16 bits)");
+
+    img::Subimage sb{img0, img::Position{20, 30}, img::Size2D{40, 50}};
+    auto gs = img::plano_intensidad(sb);
+    CHECK_TRUE(gs.rows() == 40 and gs.cols() == 50 and
+	       gs(5, 7) == img::intensidad(img0(25, 37)),
+	       "plano_intensidad(Subimage)");
+}
+
+
+int main()
+{
+try{
+
+    test::header("img_color_space.h");
+    img::num_threads(4);
+
+    test_hsv();
+    test_hsl();
+    test_ycbcr();
+    test_lab();
+    test_imagen();
+    test_intensidad();
+
+}catch(const std::exception& e){
+    std::cerr << e.what() << '\n';
+    return 1;
+}
+
+    return 0;
+}
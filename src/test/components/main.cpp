@@ -0,0 +1,147 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "../../img_components.h"
+
+#include <alp_test.h>
+
+#include <iostream>
+#include <vector>
+
+using namespace test;
+
+// Etiquetamos a lo bruto (recorrido en anchura) para comparar.
+template <typename Pred>
+img::Plane<int> etiqueta(const img::Image& img0, img::Conectividad con,
+			 Pred pred, int& n)
+{
+    int rows = img0.rows(), cols = img0.cols();
+    img::Plane<int> et{rows, cols};
+    std::fill(et.begin(), et.end(), -1);
+
+    n = 0;
+    for (int i = 0; i < rows; ++i)
+	for (int j = 0; j < cols; ++j){
+	    if (et(i, j) != -1) continue;
+
+	    std::vector<img::Position> pila{img::Position{i, j}};
+	    et(i, j) = n;
+	    while (!pila.empty()){
+		auto p = pila.back();
+		pila.pop_back();
+		for (int di = -1; di <= 1; ++di)
+		    for (int dj = -1; dj <= 1; ++dj){
+			if (di == 0 and dj == 0) continue;
+			if (con == img::Conectividad::cuatro and di != 0 and dj != 0)
+			    continue;
+			img::Position q{p.i + di, p.j + dj};
+			if (q.i < 0 or q.i >= rows or q.j < 0 or q.j >= cols)
+			    continue;
+			if (et(q) == -1 and pred(img0(p), img0(q))){
+			    et(q) = n;
+			    pila.push_back(q);
+			}
+		    }
+	    }
+	    ++n;
+	}
+
+    return et;
+}
+
+void test_componentes(int rows, int cols, img::Conectividad con)
+{
+    test::interfaz("componentes_conexas");
+
+    // Imagen con manchas de colores
+    img::Image img0{rows, cols};
+    for (int i = 0; i < rows; ++i)
+	for (int j = 0; j < cols; ++j){
+	    int x = ((i*i + 3*j*i + 7*j) / 5) % 3 == 0? 200: 0;
+	    img0(i, j) = img::ColorRGB{x, x, x};
+	}
+
+    auto cc = img::componentes_conexas(img0, con);
+
+    int n;
+    auto et = etiqueta(img0, con, img::Son_continuos{}, n);
+
+    CHECK_TRUE(cc.size() == n, "número de componentes");
+    CHECK_EQUAL_CONTAINERS(cc.etiqueta.begin(), cc.etiqueta.end(),
+			   et.begin(), et.end(), "etiquetas");
+
+    std::vector<int> npixels(n, 0);
+    for (auto k: et) ++npixels[k];
+
+    bool ok = true;
+    for (int k = 0; k < n; ++k)
+	if (cc.componentes[k].npixels != npixels[k]) ok = false;
+    CHECK_TRUE(ok, "npixels");
+
+    ok = true;
+    for (int i = 0; i < rows; ++i)
+	for (int j = 0; j < cols; ++j){
+	    const auto& c = cc.componentes[et(i, j)];
+	    if (i < c.p0.i or i > c.pe.i or j < c.p0.j or j > c.pe.j)
+		ok = false;
+	}
+    CHECK_TRUE(ok, "rectángulo");
+}
+
+
+void test_predicado()
+{
+    test::interfaz("componentes_conexas(pred)");
+
+    // 4 cuadrantes, con pred = mismo red
+    img::Image img0{4, 4};
+    for (int i = 0; i < 4; ++i)
+	for (int j = 0; j < 4; ++j)
+	    img0(i, j) = img::ColorRGB{(i/2)*2 + j/2, i, j};
+
+    auto cc = img::componentes_conexas(img0, img::Conectividad::ocho,
+		    [](const img::ColorRGB& a, const img::ColorRGB& b)
+		    { return a.r == b.r; });
+
+    CHECK_TRUE(cc.size() == 4, "size");
+    CHECK_TRUE(cc.etiqueta(3, 3) == 3, "etiqueta");
+    CHECK_TRUE(cc.componentes[1].npixels == 4, "npixels");
+    CHECK_TRUE((cc.componentes[1].p0 == img::Position{0, 2}), "p0");
+    CHECK_TRUE((cc.componentes[1].pe == img::Position{1, 3}), "pe");
+}
+
+int main()
+{
+try{
+
+    img::num_threads(4);	// para probar también el reparto en bandas
+    test::header("img_components.h");
+    test_componentes(1, 1, img::Conectividad::cuatro);
+    test_componentes(13, 17, img::Conectividad::cuatro);
+    test_componentes(13, 17, img::Conectividad::ocho);
+    test_componentes(400, 500, img::Conectividad::cuatro); // en paralelo
+    test_componentes(400, 500, img::Conectividad::ocho);
+    test_predicado();
+
+}catch(const std::exception& e){
+    std::cerr << e.what() << '\n';
+    return 1;
+}
+
+    return 0;
+}
@@ -0,0 +1,176 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "../../img_contour.h"
+#include "../../img_components.h"
+
+#include <alp_test.h>
+
+#include <iostream>
+#include <set>
+#include <random>
+
+using namespace test;
+
+void test_vector_direccion()
+{
+    test::interfaz("Vector_direccion");
+
+    auto d = img::Vector_direccion::E();
+    d.gira_45(true);
+    CHECK_TRUE(d == img::Vector_direccion::NE(), "gira_45(+)");
+    CHECK_TRUE(d.x() == 1 and d.y() == 1, "gira_45(+)");
+
+    d.gira_90(true);
+    CHECK_TRUE(d == img::Vector_direccion::NW(), "gira_90(+)");
+    CHECK_TRUE(d.x() == -1 and d.y() == 1, "gira_90(+)");
+
+    d.gira_90(false);
+    d.gira_45(false);
+    CHECK_TRUE(d == img::Vector_direccion::E(), "gira(-)");
+
+    d.gira_45(false);
+    CHECK_TRUE(d == img::Vector_direccion::SE(), "gira_45(-)");
+    CHECK_TRUE(d.x() == 1 and d.y() == -1, "gira_45(-)");
+
+    img::Image img0{3, 3};
+    img::Iterator2D p{img0, img::Position{0, 2}};
+    CHECK_TRUE(p.puedo_moverme(img::Vector_direccion::S()), "puedo_moverme");
+    CHECK_TRUE(p.puedo_moverme(img::Vector_direccion::W()), "puedo_moverme");
+    CHECK_TRUE(!p.puedo_moverme(img::Vector_direccion::E()), "puedo_moverme");
+    CHECK_TRUE(!p.puedo_moverme(img::Vector_direccion::N()), "puedo_moverme");
+}
+
+
+void test_cuadrado()
+{
+    test::interfaz("contorno");
+
+    img::Plane<int> et{5, 6};
+    std::fill(et.begin(), et.end(), -1);
+    for (int i = 1; i <= 3; ++i)
+	for (int j = 1; j <= 4; ++j)
+	    et(i, j) = 7;
+
+    auto c = img::contorno(et, img::Position{1, 1});
+    CHECK_TRUE(c.etiqueta == 7, "etiqueta");
+    CHECK_TRUE(c.cadena.size() == 10, "size");
+
+    // Bajamos por la izquierda: la región queda a la izquierda
+    CHECK_TRUE(c.direccion(0) == img::Direccion::S, "sentido");
+    CHECK_TRUE(c.direccion(2) == img::Direccion::E, "sentido");
+
+    auto ps = img::puntos(c);
+    CHECK_TRUE(ps.size() == 10, "puntos");
+    CHECK_TRUE((ps[0] == img::Position{1, 1}), "puntos");
+    CHECK_TRUE((ps[2] == img::Position{3, 1}), "puntos");
+    CHECK_TRUE((ps[5] == img::Position{3, 4}), "puntos");
+
+    // Pixel aislado
+    img::Plane<int> et1{1, 1};
+    et1(0, 0) = 0;
+    auto c1 = img::contorno(et1, img::Position{0, 0});
+    CHECK_TRUE(c1.cadena.empty() and c1.size() == 1, "pixel aislado");
+}
+
+
+// Comparo con los pixeles del borde exterior calculados a lo bruto.
+void test_aleatorio()
+{
+    test::interfaz("contornos (aleatorio)");
+
+    std::mt19937 gen{12345};
+    std::uniform_int_distribution<int> tam{1, 12};
+    std::bernoulli_distribution lleno{0.55};
+
+    bool ok = true;
+    for (int prueba = 0; prueba < 300; ++prueba){
+	int rows = tam(gen), cols = tam(gen);
+	img::Image img0{rows, cols};
+	for (auto& c: img0)
+	    c = (lleno(gen)? img::ColorRGB::blanco(): img::ColorRGB::negro());
+
+	auto cc = img::componentes_conexas(img0, img::Conectividad::ocho,
+		    [](const img::ColorRGB& a, const img::ColorRGB& b)
+		    { return a == b; });
+
+	auto cs = img::contornos(cc.etiqueta);
+	if (static_cast<int>(cs.size()) != cc.size()) ok = false;
+
+	for (int k = 0; k < cc.size(); ++k){
+	    // exterior = pixeles fuera de la región alcanzables desde fuera
+	    // de la imagen con 4-conectividad.
+	    img::Plane<int> ext{rows + 2, cols + 2};
+	    std::fill(ext.begin(), ext.end(), 0);
+	    auto en_region = [&](int i, int j){
+		return 0 <= i and i < rows and 0 <= j and j < cols
+		       and cc.etiqueta(i, j) == k;
+	    };
+
+	    std::vector<img::Position> pila{img::Position{-1, -1}};
+	    ext(0, 0) = 1;
+	    while (!pila.empty()){
+		auto p = pila.back(); pila.pop_back();
+		for (auto d: {img::Position{0,1}, img::Position{0,-1},
+			      img::Position{1,0}, img::Position{-1,0}}){
+		    img::Position q{p.i + d.i, p.j + d.j};
+		    if (q.i < -1 or q.i > rows or q.j < -1 or q.j > cols)
+			continue;
+		    if (!en_region(q.i, q.j) and !ext(q.i + 1, q.j + 1)){
+			ext(q.i + 1, q.j + 1) = 1;
+			pila.push_back(q);
+		    }
+		}
+	    }
+
+	    std::set<std::pair<int,int>> borde;
+	    for (int i = 0; i < rows; ++i)
+		for (int j = 0; j < cols; ++j)
+		    if (en_region(i, j) and
+			(ext(i, j + 1) or ext(i + 2, j + 1) or
+			 ext(i + 1, j) or ext(i + 1, j + 2)))
+			borde.insert({i, j});
+
+	    std::set<std::pair<int,int>> traza;
+	    for (auto p: img::puntos(cs[k]))
+		traza.insert({p.i, p.j});
+
+	    if (cs[k].etiqueta != k or traza != borde)
+		ok = false;
+	}
+    }
+
+    CHECK_TRUE(ok, "contornos");
+}
+
+int main()
+{
+try{
+
+    test::header("img_contour.h");
+    test_vector_direccion();
+    test_cuadrado();
+    test_aleatorio();
+
+}catch(const std::exception& e){
+    std::cerr << e.what() << '\n';
+    return 1;
+}
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "../../img_diff.h"
+#include "../../img_view.h"
+
+#include <alp_test.h>
+
+#include <iostream>
+#include <cmath>
+
+using namespace test;
+
+using img::ColorRGB;
+
+
+void test_compara()
+{
+    test::interfaz("compara");
+
+    // Valores lejos de 0 y 255: las diferencias que se introducen abajo no
+    // se salen del rango
+    img::Image a{200, 150};
+    for (int i = 0; i < 200; ++i)
+	for (int j = 0; j < 150; ++j)
+	    a(i, j) = ColorRGB{50 + i % 150, 50 + j % 150, 128};
+    img::Image b = a;
+
+    img::Diferencias d = img::compara(a, b);
+    CHECK_TRUE(d.iguales() and d.error_max == (ColorRGB{0, 0, 0}) and
+	       d.error_medio_r == 0 and d.zona.i0 == d.zona.ie, "compara(iguales)");
+    CHECK_TRUE(!img::hay_diferencias(a, b), "hay_diferencias(iguales)");
+
+    b(20, 30).r += 1;	    // dentro de la tolerancia
+    b(50, 10).g -= 5;
+    b(150, 140).b += 3;
+    b(120, 60) = ColorRGB{a(120, 60).r + 3, a(120, 60).g - 3, a(120, 60).b};
+
+    d = img::compara(a, b);
+    CHECK_TRUE(d.n == 4, "compara");
+    CHECK_TRUE(d.error_max == (ColorRGB{3, 5, 3}), "compara(error_max)");
+    CHECK_TRUE(std::abs(d.error_medio_r - 4.0 / (200 * 150)) < 1e-12 and
+	       std::abs(d.error_medio_g - 8.0 / (200 * 150)) < 1e-12, "compara(error_medio)");
+    CHECK_TRUE(d.zona.i0 == 20 and d.zona.ie == 151 and d.zona.j0 == 10 and
+	       d.zona.je == 141, "compara(zona)");
+
+    d = img::compara(a, b, 3);
+    CHECK_TRUE(d.n == 1 and d.zona.i0 == 50 and d.zona.ie == 51 and
+	       d.zona.j0 == 10 and d.zona.je == 11, "compara(tolerancia)");
+    CHECK_TRUE(img::hay_diferencias(a, b, 3) and !img::hay_diferencias(a, b, 5),
+	       "hay_diferencias(tolerancia)");
+
+    // máscara
+    img::Plane<std::uint8_t> m{1, 1};
+    d = img::compara(a, b, 1, m);
+    int n = 0;
+    for (int i = 0; i < m.rows(); ++i)
+	for (int j = 0; j < m.cols(); ++j)
+	    n += (m(i, j) == 255);
+    CHECK_TRUE(m.rows() == 200 and m.cols() == 150 and n == 3 and
+	       m(50, 10) == 255 and m(20, 30) == 0, "compara(mascara)");
+
+    // Subimage
+    img::Subimage sa{a, img::Position{40, 0}, img::Size2D{100, 100}};
+    img::Subimage sb{b, img::Position{40, 0}, img::Size2D{100, 100}};
+    d = img::compara(sa, sb);
+    CHECK_TRUE(d.n == 2 and d.zona.i0 == 10 and d.zona.ie == 81 and
+	       d.zona.j0 == 10 and d.zona.je == 61, "compara(Subimage)");
+
+    // distinto tamaño
+    img::Image c{10, 10};
+    bool lanza = false;
+    try{ img::compara(a, c); }
+    catch(const std::logic_error&) { lanza = true; }
+    CHECK_TRUE(lanza, "compara(distinto tamaño)");
+}
+
+
+int main()
+{
+try{
+
+    test::header("img_diff.h");
+    img::num_threads(4);
+
+    test_compara();
+
+}catch(const std::exception& e){
+    std::cerr << e.what() << '\n';
+    return 1;
+}
+
+    return 0;
+}
@@ -0,0 +1,218 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "../../img_dirty.h"
+
+#include <alp_test.h>
+
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+#include <stdexcept>
+
+using namespace test;
+
+// ¿Están todos los pixeles distintos de img0 e img1 dentro de alguna de
+// las zonas?
+static bool cubiertos(const img::Image& img0, const img::Image& img1,
+		      const std::vector<img::Ventana>& zonas)
+{
+    for (int i = 0; i < img0.rows(); ++i)
+	for (int j = 0; j < img0.cols(); ++j){
+	    if (img0(i, j) == img1(i, j))
+		continue;
+
+	    bool ok = std::any_of(zonas.begin(), zonas.end(),
+		    [i, j](const img::Ventana& w){
+			return w.i0 <= i and i < w.ie and w.j0 <= j and j < w.je;
+		    });
+	    if (!ok)
+		return false;
+	}
+
+    return true;
+}
+
+
+// Las zonas no se solapan y cubren exactamente las teselas modificadas
+static bool zonas_correctas(const img::Registro_cambios& reg)
+{
+    auto zonas = reg.zonas();
+
+    int area = 0;
+    for (const auto& w: zonas)
+	area += (w.ie - w.i0) * (w.je - w.j0);
+
+    int area_teselas = 0;
+    for (int ti = 0; ti < reg.rows_teselas(); ++ti)
+	for (int tj = 0; tj < reg.cols_teselas(); ++tj)
+	    if (reg.modificada(ti, tj)){
+		img::Ventana t = reg.tesela(ti, tj);
+		area_teselas += (t.ie - t.i0) * (t.je - t.j0);
+
+		bool dentro = std::any_of(zonas.begin(), zonas.end(),
+			[&](const img::Ventana& w){
+			    return w.i0 <= t.i0 and t.ie <= w.ie and
+				   w.j0 <= t.j0 and t.je <= w.je;
+			});
+		if (!dentro)
+		    return false;
+	    }
+
+    return area == area_teselas;
+}
+
+
+void test_registro()
+{
+    test::interfaz("Registro_cambios");
+
+    img::Registro_cambios reg{100, 150, 32};
+    CHECK_TRUE(reg.rows_teselas() == 4 and reg.cols_teselas() == 5,
+	       "Registro_cambios(rows, cols, lado)");
+    CHECK_TRUE(!reg.hay_cambios() and reg.zonas().empty(), "hay_cambios");
+
+    reg.marca(5, 10);
+    reg.marca(40, 20, 70);	    // teselas (1, 0), (1, 1), (1, 2)
+    CHECK_TRUE(reg.hay_cambios() and reg.num_teselas() == 4, "marca");
+    CHECK_TRUE(reg.modificada(0, 0) and reg.modificada(1, 2) and
+	       !reg.modificada(1, 3), "marca");
+
+    // Fuera de la imagen se ignora
+    reg.marca(img::Ventana{-10, 0, 0, 150});
+    reg.marca(img::Ventana{96, 200, 140, 300});	    // tesela (3, 4)
+    CHECK_TRUE(reg.num_teselas() == 5 and reg.modificada(3, 4), "marca(Ventana)");
+
+    // La última tesela está recortada
+    img::Ventana t = reg.tesela(3, 4);
+    CHECK_TRUE(t.i0 == 96 and t.ie == 100 and t.j0 == 128 and t.je == 150,
+	       "tesela");
+
+    auto zonas = reg.zonas();
+    CHECK_TRUE(zonas.size() == 3 and zonas_correctas(reg), "zonas");
+
+    img::Ventana w = reg.zona_total();
+    CHECK_TRUE(w.i0 == 0 and w.ie == 100 and w.j0 == 0 and w.je == 150,
+	       "zona_total");
+
+    reg.limpia();
+    CHECK_TRUE(!reg.hay_cambios() and reg.num_teselas() == 0 and
+	       reg.zonas().empty(), "limpia");
+
+    // Un bloque de teselas es un único rectángulo
+    reg.marca(img::Rectangulo{img::Position{10, 10}, img::Position{70, 100}});
+    zonas = reg.zonas();
+    CHECK_TRUE(zonas.size() == 1 and zonas[0].i0 == 0 and zonas[0].ie == 96
+	       and zonas[0].j0 == 0 and zonas[0].je == 128, "zonas(bloque)");
+
+    // Pixeles y filas fuera de la imagen: se ignoran o se recortan
+    reg.limpia();
+    reg.marca(-1, 5);
+    reg.marca(100, 5);
+    reg.marca(5, -1);
+    reg.marca(5, 150);
+    reg.marca(-5, 0, 10);
+    reg.marca(100, 0, 10);
+    CHECK_TRUE(!reg.hay_cambios(), "marca(fuera)");
+    reg.marca(70, -20, 5);	    // tesela (2, 0)
+    reg.marca(70, 140, 400);	    // tesela (2, 4)
+    CHECK_TRUE(reg.num_teselas() == 2 and reg.modificada(2, 0) and
+	       reg.modificada(2, 4), "marca(fila recortada)");
+
+    // Aleatorio
+    std::srand(29);
+    for (int k = 0; k < 100; ++k){
+	img::Registro_cambios r{100, 150, 16};
+	for (int m = 0; m < 10; ++m)
+	    r.marca(std::rand() % 100, std::rand() % 150);
+	CHECK_TRUE(zonas_correctas(r), "zonas(aleatorio)");
+    }
+
+    bool lanza = false;
+    try{ img::Registro_cambios r{100, 150, 0}; }
+    catch(const std::logic_error&) { lanza = true; }
+    CHECK_TRUE(lanza, "Registro_cambios(lado = 0)");
+}
+
+
+void test_draw()
+{
+    test::interfaz("draw(Registro_cambios)");
+
+    using img::Position;
+    using img::Segmento;
+
+    img::Image base = img::imagen_negra(200, 300);
+    img::Image img0 = base;
+    img::Registro_cambios reg{200, 300, 16};
+
+    img::draw(img0, reg, Segmento{Position{-20, 10}, Position{250, 200}},
+	      img::ColorRGB::rojo());
+    img::draw_aa(img0, reg, Segmento{Position{199, 0}, Position{0, 299}},
+		 img::ColorRGB::blanco());
+    img::draw_grueso(img0, reg, Segmento{Position{50, 50}, Position{60, 250}},
+		     7, img::ColorRGB::verde());
+    img::draw_circulo(img0, reg, img::Circulo{Position{150, 250}, 30},
+		      img::ColorRGB::azul());
+    img::draw(img0, reg, img::Rectangulo{Position{5, 5}, Position{40, 290}},
+	      img::ColorRGB::blanco());
+
+    CHECK_TRUE(cubiertos(base, img0, reg.zonas()), "draw(Registro_cambios)");
+    CHECK_TRUE(zonas_correctas(reg), "draw(Registro_cambios)");
+
+    // Solo se marcan las teselas por las que pasa el segmento, no todo
+    // el rectángulo que lo contiene.
+    img::Registro_cambios r2{200, 300, 16};
+    img::Image img1 = base;
+    img::draw(img1, r2, Segmento{Position{0, 0}, Position{199, 299}},
+	      img::ColorRGB::rojo());
+    CHECK_TRUE(r2.num_teselas() < 2 * (300 / 16 + 1), "draw(diagonal)");
+    CHECK_TRUE(cubiertos(base, img1, r2.zonas()), "draw(diagonal)");
+
+    // Subimagen
+    img::Registro_cambios r3{200, 300, 16};
+    img::Image img2 = base;
+    auto sb = img::subimagen_modificable(img2, r3, Position{20, 30},
+					 img::Size2D{10, 40});
+    for (int i = 0; i < sb.rows(); ++i)
+	for (int j = 0; j < sb.cols(); ++j)
+	    sb(i, j) = img::ColorRGB::blanco();
+
+    CHECK_TRUE(cubiertos(base, img2, r3.zonas()), "subimagen_modificable");
+    img::Ventana w = r3.zona_total();
+    CHECK_TRUE(w.i0 == 16 and w.ie == 32 and w.j0 == 16 and w.je == 80,
+	       "subimagen_modificable");
+}
+
+
+int main()
+{
+try{
+
+    test::header("img_dirty.h");
+    test_registro();
+    test_draw();
+
+}catch(const std::exception& e){
+    std::cerr << e.what() << '\n';
+    return 1;
+}
+
+    return 0;
+}
@@ -17,10 +17,14 @@
 
 
 #include "../../img_draw.h"
+#include "../../img_parallel.h"
 
 #include <alp_test.h>
 
 #include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
 
 
 using namespace test;
@@ -51,12 +55,726 @@ void test_draw()
 }
 
 
+// Número de pixeles de img0 de color c
+int cuenta(const img::Image& img0, const img::ColorRGB& c)
+{
+    int n = 0;
+    for (const auto& x: img0)
+	if (x == c) ++n;
+
+    return n;
+}
+
+
+void test_draw_segmento()
+{
+    test::interfaz("draw(Segmento)");
+
+    using img::Segmento;
+    using img::Position;
+    auto blanco = img::ColorRGB::blanco();
+
+    {// horizontal y vertical
+	img::Image img0 = img::imagen_negra(5, 6);
+	img::draw(img0, Segmento{Position{1, 4}, Position{1, 1}}, blanco);
+	img::draw(img0, Segmento{Position{2, 5}, Position{4, 5}}, blanco);
+
+	CHECK_TRUE(cuenta(img0, blanco) == 4 + 3, "draw(horizontal, vertical)");
+	CHECK_TRUE(img0(1, 1) == blanco and img0(1, 4) == blanco and
+		   img0(2, 5) == blanco and img0(4, 5) == blanco,
+		   "draw(horizontal, vertical)");
+    }
+
+    {// diagonal
+	img::Image img0 = img::imagen_negra(5, 5);
+	img::draw(img0, Segmento{Position{4, 0}, Position{0, 4}}, blanco);
+
+	CHECK_TRUE(cuenta(img0, blanco) == 5, "draw(diagonal)");
+	for (int k = 0; k < 5; ++k)
+	    CHECK_TRUE(img0(4 - k, k) == blanco, "draw(diagonal)");
+    }
+
+    {// un punto
+	img::Image img0 = img::imagen_negra(3, 3);
+	img::draw(img0, Segmento{Position{1, 2}, Position{1, 2}}, blanco);
+	CHECK_TRUE(cuenta(img0, blanco) == 1 and img0(1, 2) == blanco,
+		   "draw(punto)");
+    }
+
+    {// fuera de la imagen no se dibuja nada
+	img::Image img0 = img::imagen_negra(4, 4);
+	img::draw(img0, Segmento{Position{-5, -1}, Position{-1, 10}}, blanco);
+	img::draw(img0, Segmento{Position{10, 2}, Position{2, 10}}, blanco);
+	img::draw(img0, Segmento{Position{1, -3}, Position{1, -1}}, blanco);
+	CHECK_TRUE(cuenta(img0, blanco) == 0, "draw(fuera)");
+    }
+
+    // Los segmentos completamente dentro son continuos: pintan
+    // max(|di|, |dj|) + 1 pixeles, uno por cada valor del driving axis.
+    std::srand(7);
+    for (int k = 0; k < 200; ++k){
+	img::Image img0 = img::imagen_negra(20, 30);
+	Position A{std::rand() % 20, std::rand() % 30};
+	Position B{std::rand() % 20, std::rand() % 30};
+
+	img::draw(img0, Segmento{A, B}, blanco);
+
+	int n = std::max(std::abs(B.i - A.i), std::abs(B.j - A.j)) + 1;
+	CHECK_TRUE(cuenta(img0, blanco) == n and
+		   img0(A.i, A.j) == blanco and img0(B.i, B.j) == blanco,
+		   "draw(segmento dentro)");
+    }
+
+    // Recortar no cambia la recta: dibujamos el segmento en una imagen
+    // grande que lo contiene entero y comparamos.
+    for (int k = 0; k < 500; ++k){
+	constexpr int rows = 20, cols = 30, d = 40;
+
+	Position A{std::rand() % 100 - d, std::rand() % 110 - d};
+	Position B{std::rand() % 100 - d, std::rand() % 110 - d};
+
+	img::Image img0 = img::imagen_negra(rows, cols);
+	img::draw(img0, Segmento{A, B}, blanco);
+
+	img::Image grande = img::imagen_negra(rows + 2*d + 40, cols + 2*d + 40);
+	img::draw(grande, Segmento{Position{A.i + d, A.j + d},
+				   Position{B.i + d, B.j + d}}, blanco);
+
+	bool ok = true;
+	for (int i = 0; i < rows; ++i)
+	    for (int j = 0; j < cols; ++j)
+		if (img0(i, j) != grande(i + d, j + d))
+		    ok = false;
+
+	CHECK_TRUE(ok, "draw(recortado)");
+    }
+}
+
+
+void test_draw_segmentos()
+{
+    test::interfaz("draw(span<Segmento>)");
+
+    using img::Segmento;
+    using img::Position;
+    auto rojo = img::ColorRGB::rojo();
+
+    std::vector<Segmento> ss;
+    std::srand(11);
+    for (int k = 0; k < 5000; ++k)
+	ss.push_back(Segmento{Position{std::rand() % 300 - 50, std::rand() % 300 - 50},
+			      Position{std::rand() % 300 - 50, std::rand() % 300 - 50}});
+    ss.push_back(Segmento{Position{10, -10}, Position{10, 500}});
+    ss.push_back(Segmento{Position{-10, 7}, Position{500, 7}});
+
+    img::Image img0 = img::imagen_negra(200, 200);
+    for (const auto& s: ss)
+	img::draw(img0, s, rojo);
+
+    img::Image img1 = img::imagen_negra(200, 200);
+    img::draw(img1, ss, rojo);
+
+    CHECK_TRUE(img0.size2D() == img1.size2D(), "draw(span<Segmento>)");
+    CHECK_EQUAL_CONTAINERS(img0.begin(), img0.end(), img1.begin(), img1.end(),
+    		       "draw(span<Segmento>)");
+}
+
+
+void test_draw_lineas()
+{
+    test::interfaz("draw_lineaH/V, draw(Rectangulo)");
+
+    auto verde = img::ColorRGB::verde();
+
+    {
+	img::Image img0 = img::imagen_negra(4, 5);
+	img::draw_lineaH(img0, 2, verde);
+	img::draw_lineaV(img0, 1, verde);
+	img::draw_lineaH(img0, 4, verde);	// fuera: no hace nada
+	img::draw_lineaV(img0, -1, verde);
+
+	CHECK_TRUE(cuenta(img0, verde) == 5 + 4 - 1, "draw_lineaH/V");
+	for (int j = 0; j < 5; ++j)
+	    CHECK_TRUE(img0(2, j) == verde, "draw_lineaH");
+	for (int i = 0; i < 4; ++i)
+	    CHECK_TRUE(img0(i, 1) == verde, "draw_lineaV");
+    }
+
+    {
+	img::Image img0 = img::imagen_negra(6, 7);
+	img::draw(img0, img::Rectangulo{img::Position{1, 1}, img::Position{4, 5}},
+		  verde);
+
+	CHECK_TRUE(cuenta(img0, verde) == 2*5 + 2*2, "draw(Rectangulo)");
+	CHECK_TRUE(img0(1, 1) == verde and img0(4, 5) == verde and
+		   img0(2, 1) == verde and img0(4, 3) == verde and
+		   img0(2, 2) != verde, "draw(Rectangulo)");
+    }
+}
+
+
+void test_draw_aa()
+{
+    test::interfaz("draw_aa");
+
+    using img::Segmento;
+    using img::Position;
+    auto blanco = img::ColorRGB::blanco();
+    auto negro  = img::ColorRGB::negro();
+
+    {// horizontal, vertical y diagonal: sin mezcla
+	img::Image img0 = img::imagen_negra(6, 6);
+	img::draw_aa(img0, Segmento{Position{0, 0}, Position{0, 5}}, blanco);
+	img::draw_aa(img0, Segmento{Position{5, 0}, Position{5, 5}}, blanco);
+	img::draw_aa(img0, Segmento{Position{1, 1}, Position{4, 4}}, blanco);
+
+	CHECK_TRUE(cuenta(img0, blanco) == 6 + 6 + 4, "draw_aa(sin mezcla)");
+	CHECK_TRUE(cuenta(img0, blanco) + cuenta(img0, negro) == 36,
+		   "draw_aa(sin mezcla)");
+    }
+
+    {// la recta pasa por el medio de (0, 2) y (1, 2)
+	img::Image img0 = img::imagen_negra(3, 5);
+	img::draw_aa(img0, Segmento{Position{0, 0}, Position{1, 4}}, blanco);
+
+	CHECK_TRUE(img0(0, 0) == blanco and img0(1, 4) == blanco,
+		   "draw_aa(extremos)");
+	CHECK_TRUE(img0(0, 2).r + img0(1, 2).r == 255 and
+		   std::abs(img0(0, 2).r - img0(1, 2).r) <= 1,
+		   "draw_aa(mitad)");
+    }
+
+    // La cobertura de cada columna suma 255 y el resultado es el mismo
+    // recortando que sin recortar.
+    std::srand(13);
+    for (int k = 0; k < 300; ++k){
+	constexpr int rows = 20, cols = 30, d = 40;
+
+	Position A{std::rand() % 100 - d, std::rand() % 110 - d};
+	Position B{std::rand() % 100 - d, std::rand() % 110 - d};
+
+	img::Image img0 = img::imagen_negra(rows, cols);
+	img::draw_aa(img0, Segmento{A, B}, blanco);
+
+	img::Image grande = img::imagen_negra(rows + 2*d + 40, cols + 2*d + 40);
+	Segmento s{Position{A.i + d, A.j + d}, Position{B.i + d, B.j + d}};
+	img::draw_aa(grande, s, blanco);
+
+	bool ok = true;
+	for (int i = 0; i < rows; ++i)
+	    for (int j = 0; j < cols; ++j)
+		if (img0(i, j) != grande(i + d, j + d))
+		    ok = false;
+
+	CHECK_TRUE(ok, "draw_aa(recortado)");
+
+	// Suma de la intensidad a lo largo del driving axis
+	bool eje_i = std::abs(B.i - A.i) >= std::abs(B.j - A.j);
+	int u0 = eje_i? std::min(s.A.i, s.B.i): std::min(s.A.j, s.B.j);
+	int ue = eje_i? std::max(s.A.i, s.B.i): std::max(s.A.j, s.B.j);
+
+	for (int u = u0; u <= ue; ++u){
+	    int n = 0;
+	    if (eje_i)
+		for (int j = 0; j < grande.cols(); ++j) n += grande(u, j).r;
+	    else
+		for (int i = 0; i < grande.rows(); ++i) n += grande(i, u).r;
+
+	    CHECK_TRUE(254 <= n and n <= 256, "draw_aa(cobertura)");
+	}
+    }
+
+    {// en lote
+	std::vector<Segmento> ss;
+	for (int k = 0; k < 3000; ++k)
+	    ss.push_back(Segmento{Position{std::rand() % 300 - 50, std::rand() % 300 - 50},
+				  Position{std::rand() % 300 - 50, std::rand() % 300 - 50}});
+
+	img::Image img0 = img::imagen_negra(200, 200);
+	for (const auto& s: ss)
+	    img::draw_aa(img0, s, img::ColorRGB::rojo());
+
+	img::Image img1 = img::imagen_negra(200, 200);
+	img::draw_aa(img1, ss, img::ColorRGB::rojo());
+
+	CHECK_TRUE(img0.size2D() == img1.size2D(), "draw_aa(span<Segmento>)");
+	CHECK_EQUAL_CONTAINERS(img0.begin(), img0.end(), img1.begin(), img1.end(),
+			       "draw_aa(span<Segmento>)");
+    }
+}
+
+
+void test_draw_grueso()
+{
+    test::interfaz("draw_grueso");
+
+    using img::Segmento;
+    using img::Position;
+    using img::Extremo;
+    auto blanco = img::ColorRGB::blanco();
+
+    {
+	img::Image img0 = img::imagen_negra(8, 14);
+	img::draw_grueso(img0, Segmento{Position{2, 2}, Position{2, 10}}, 5,
+			 blanco, Extremo::cuadrado);
+
+	// filas [-0.5, 4.5], columnas [-0.5, 12.5]
+	CHECK_TRUE(cuenta(img0, blanco) == 5 * 13, "draw_grueso(cuadrado)");
+	CHECK_TRUE(img0(0, 0) == blanco and img0(4, 12) == blanco and
+		   img0(5, 5) != blanco and img0(2, 13) != blanco,
+		   "draw_grueso(cuadrado)");
+    }
+
+    {
+	img::Image img0 = img::imagen_negra(8, 14);
+	img::draw_grueso(img0, Segmento{Position{2, 2}, Position{2, 10}}, 5,
+			 blanco, Extremo::redondo);
+
+	CHECK_TRUE(img0(0, 0) != blanco and img0(0, 1) == blanco and
+		   img0(2, 0) == blanco and img0(2, 12) == blanco and
+		   img0(4, 11) == blanco and img0(4, 12) != blanco,
+		   "draw_grueso(redondo)");
+	for (int j = 2; j <= 10; ++j)
+	    CHECK_TRUE(img0(0, j) == blanco and img0(4, j) == blanco,
+		       "draw_grueso(redondo)");
+    }
+
+    {// diagonal: simétrico respecto del segmento
+	img::Image img0 = img::imagen_negra(20, 20);
+	img::draw_grueso(img0, Segmento{Position{4, 4}, Position{15, 15}}, 4,
+			 blanco);
+
+	bool ok = true;
+	for (int i = 0; i < 20; ++i)
+	    for (int j = 0; j < 20; ++j)
+		if (img0(i, j) != img0(j, i))
+		    ok = false;
+
+	CHECK_TRUE(ok, "draw_grueso(simetría)");
+	CHECK_TRUE(img0(5, 7) == blanco and img0(5, 9) != blanco,
+		   "draw_grueso(diagonal)");
+    }
+
+    {// recortado y en lote
+	std::vector<Segmento> ss;
+	std::srand(17);
+	for (int k = 0; k < 500; ++k)
+	    ss.push_back(Segmento{Position{std::rand() % 300 - 50, std::rand() % 300 - 50},
+				  Position{std::rand() % 300 - 50, std::rand() % 300 - 50}});
+
+	img::Image img0 = img::imagen_negra(200, 200);
+	for (const auto& s: ss)
+	    img::draw_grueso(img0, s, 3, blanco);
+
+	img::Image img1 = img::imagen_negra(200, 200);
+	img::draw_grueso(img1, ss, 3, blanco);
+
+	CHECK_TRUE(img0.size2D() == img1.size2D(), "draw_grueso(span<Segmento>)");
+	CHECK_EQUAL_CONTAINERS(img0.begin(), img0.end(), img1.begin(), img1.end(),
+			       "draw_grueso(span<Segmento>)");
+    }
+}
+
+
+// Pincel que cuenta cuántas veces se pinta cada pixel
+struct Pincel_cuenta{
+    img::Plane<int> n;
+
+    Pincel_cuenta(int rows, int cols) : n{rows, cols}
+    { std::fill(n.begin(), n.end(), 0); }
+
+    void punto(int i, int j) {++n(i, j);}
+    void punto(int i, int j, int) {++n(i, j);}
+    void tramo_h(int i, int j0, int je) { for (int j = j0; j < je; ++j) ++n(i, j); }
+    void tramo_v(int j, int i0, int ie) { for (int i = i0; i < ie; ++i) ++n(i, j); }
+
+    int max() const {return *std::max_element(n.begin(), n.end());}
+};
+
+
+// Comprueba que img0 recortada es igual a grande a partir de (d, d)
+bool igual_recortada(const img::Image& img0, const img::Image& grande, int d)
+{
+    for (int i = 0; i < img0.rows(); ++i)
+	for (int j = 0; j < img0.cols(); ++j)
+	    if (img0(i, j) != grande(i + d, j + d))
+		return false;
+
+    return true;
+}
+
+
+// El relleno tiene que contener al borde y llegar justo hasta él en cada
+// fila.
+bool relleno_ajustado(const img::Image& borde, const img::Image& relleno,
+		      const img::ColorRGB& c)
+{
+    for (int i = 0; i < borde.rows(); ++i){
+	int j0 = -1, je = -1;
+	for (int j = 0; j < borde.cols(); ++j)
+	    if (borde(i, j) == c){
+		if (j0 == -1) j0 = j;
+		je = j;
+	    }
+
+	for (int j = 0; j < borde.cols(); ++j){
+	    bool dentro = (j0 != -1 and j0 <= j and j <= je);
+	    if ((relleno(i, j) == c) != dentro)
+		return false;
+	}
+    }
+
+    return true;
+}
+
+
+void test_draw_circunferencia()
+{
+    test::interfaz("draw_circunferencia, draw_circulo");
+
+    using img::Circulo;
+    using img::Position;
+    auto blanco = img::ColorRGB::blanco();
+
+    {// radio 0: un punto
+	img::Image img0 = img::imagen_negra(5, 5);
+	img::draw_circunferencia(img0, Circulo{Position{2, 2}, 0}, blanco);
+	CHECK_TRUE(cuenta(img0, blanco) == 1 and img0(2, 2) == blanco,
+		   "draw_circunferencia(r = 0)");
+    }
+
+    {// radio 1 y 2
+	img::Image img0 = img::imagen_negra(7, 7);
+	img::draw_circunferencia(img0, Circulo{Position{3, 3}, 1}, blanco);
+	CHECK_TRUE(cuenta(img0, blanco) == 4 and img0(2, 3) == blanco and
+		   img0(3, 4) == blanco, "draw_circunferencia(r = 1)");
+
+	img0 = img::imagen_negra(7, 7);
+	img::draw_circulo(img0, Circulo{Position{3, 3}, 2}, blanco);
+	CHECK_TRUE(cuenta(img0, blanco) == 3 + 5 + 5 + 5 + 3,
+		   "draw_circulo(r = 2)");
+    }
+
+    for (int r = 0; r < 40; ++r){
+	int n = 2*r + 11;
+	Position c{n / 2, n / 2};
+
+	img::Image borde = img::imagen_negra(n, n);
+	img::draw_circunferencia(borde, Circulo{c, r}, blanco);
+
+	// Extremos y simetrías
+	CHECK_TRUE(borde(c.i - r, c.j) == blanco and borde(c.i, c.j + r) == blanco,
+		   "draw_circunferencia(extremos)");
+
+	bool ok = true;
+	for (int i = 0; i < n; ++i)
+	    for (int j = 0; j < n; ++j){
+		if (borde(i, j) != borde(j, i) or borde(i, j) != borde(n-1-i, j)
+		    or borde(i, j) != borde(i, n-1-j))
+		    ok = false;
+
+		// Todos los pixeles a distancia r +- 1/2 (aproximadamente)
+		int d2 = (i - c.i)*(i - c.i) + (j - c.j)*(j - c.j);
+		int dmin = std::max(2*r - 2, 0);
+		if (borde(i, j) == blanco and
+			(4*d2 > (2*r + 1)*(2*r + 1) or 4*d2 < dmin*dmin))
+		    ok = false;
+	    }
+	CHECK_TRUE(ok, "draw_circunferencia(forma)");
+
+	img::Image relleno = img::imagen_negra(n, n);
+	img::draw_circulo(relleno, Circulo{c, r}, blanco);
+	CHECK_TRUE(relleno_ajustado(borde, relleno, blanco),
+		   "draw_circulo(relleno)");
+
+	// Cada pixel se pinta una sola vez
+	Pincel_cuenta p0{n, n};
+	img::rasteriza_circunferencia(Circulo{c, r}, false, img::ventana(borde), p0);
+	Pincel_cuenta p1{n, n};
+	img::rasteriza_circunferencia(Circulo{c, r}, true, img::ventana(borde), p1);
+	CHECK_TRUE(p0.max() == 1 and p1.max() == 1,
+		   "rasteriza_circunferencia(una vez)");
+    }
+
+    // Recortadas
+    std::srand(19);
+    for (int k = 0; k < 300; ++k){
+	constexpr int rows = 20, cols = 30, d = 60;
+	Circulo c{Position{std::rand() % 80 - 30, std::rand() % 90 - 30},
+		  std::rand() % 50};
+
+	img::Image img0 = img::imagen_negra(rows, cols);
+	img::Image img1 = img::imagen_negra(rows, cols);
+	img::draw_circunferencia(img0, c, blanco);
+	img::draw_circulo(img1, c, blanco);
+
+	Circulo c2{Position{c.centro.i + d, c.centro.j + d}, c.radio};
+	img::Image grande0 = img::imagen_negra(rows + 2*d + 60, cols + 2*d + 60);
+	img::Image grande1 = img::imagen_negra(rows + 2*d + 60, cols + 2*d + 60);
+	img::draw_circunferencia(grande0, c2, blanco);
+	img::draw_circulo(grande1, c2, blanco);
+
+	CHECK_TRUE(igual_recortada(img0, grande0, d), "draw_circunferencia(recortada)");
+	CHECK_TRUE(igual_recortada(img1, grande1, d), "draw_circulo(recortado)");
+    }
+
+    {// en lote
+	std::vector<Circulo> cs;
+	for (int k = 0; k < 3000; ++k)
+	    cs.push_back(Circulo{Position{std::rand() % 300 - 50, std::rand() % 300 - 50},
+				 std::rand() % 30});
+
+	img::Image img0 = img::imagen_negra(200, 200);
+	img::Image img1 = img::imagen_negra(200, 200);
+	for (const auto& c: cs){
+	    img::draw_circunferencia(img0, c, blanco);
+	    img::draw_circulo(img1, c, img::ColorRGB::rojo());
+	}
+
+	img::Image img2 = img::imagen_negra(200, 200);
+	img::Image img3 = img::imagen_negra(200, 200);
+	img::draw_circunferencia(img2, cs, blanco);
+	img::draw_circulo(img3, cs, img::ColorRGB::rojo());
+
+	CHECK_TRUE(img0.size2D() == img2.size2D(), "draw_circunferencia(span<Circulo>)");
+	CHECK_EQUAL_CONTAINERS(img0.begin(), img0.end(), img2.begin(), img2.end(),
+			       "draw_circunferencia(span<Circulo>)");
+	CHECK_TRUE(img1.size2D() == img3.size2D(), "draw_circulo(span<Circulo>)");
+	CHECK_EQUAL_CONTAINERS(img1.begin(), img1.end(), img3.begin(), img3.end(),
+			       "draw_circulo(span<Circulo>)");
+    }
+}
+
+
+void test_draw_elipse()
+{
+    test::interfaz("draw_elipse");
+
+    using img::Position;
+    auto blanco = img::ColorRGB::blanco();
+
+    {// degeneradas
+	img::Image img0 = img::imagen_negra(9, 9);
+	img::draw_elipse(img0, Position{4, 4}, 3, 0, blanco);
+	CHECK_TRUE(cuenta(img0, blanco) == 7 and img0(4, 1) == blanco and
+		   img0(4, 7) == blanco, "draw_elipse(b = 0)");
+
+	img0 = img::imagen_negra(9, 9);
+	img::draw_elipse(img0, Position{4, 4}, 0, 2, blanco);
+	CHECK_TRUE(cuenta(img0, blanco) == 5 and img0(2, 4) == blanco and
+		   img0(6, 4) == blanco, "draw_elipse(a = 0)");
+    }
+
+    for (int a = 0; a < 25; a += 3)
+	for (int b = 1; b < 25; b += 4){
+	    int rows = 2*b + 5, cols = 2*a + 5;
+	    Position c{rows / 2, cols / 2};
+
+	    img::Image borde = img::imagen_negra(rows, cols);
+	    img::draw_elipse(borde, c, a, b, blanco);
+
+	    CHECK_TRUE(borde(c.i - b, c.j) == blanco and borde(c.i + b, c.j) == blanco
+		   and borde(c.i, c.j - a) == blanco and borde(c.i, c.j + a) == blanco,
+		       "draw_elipse(extremos)");
+
+	    bool ok = true;
+	    for (int i = 0; i < rows; ++i)
+		for (int j = 0; j < cols; ++j)
+		    if (borde(i, j) != borde(rows-1-i, j) or
+			borde(i, j) != borde(i, cols-1-j))
+			ok = false;
+	    CHECK_TRUE(ok, "draw_elipse(simetría)");
+
+	    img::Image relleno = img::imagen_negra(rows, cols);
+	    img::draw_elipse_rellena(relleno, c, a, b, blanco);
+	    CHECK_TRUE(relleno_ajustado(borde, relleno, blanco),
+		       "draw_elipse_rellena");
+
+	    Pincel_cuenta p0{rows, cols};
+	    img::rasteriza_elipse(c, a, b, false, img::ventana(borde), p0);
+	    Pincel_cuenta p1{rows, cols};
+	    img::rasteriza_elipse(c, a, b, true, img::ventana(borde), p1);
+	    CHECK_TRUE(p0.max() == 1 and p1.max() == 1,
+		       "rasteriza_elipse(una vez)");
+
+	    // Recortada
+	    img::Image peq = img::imagen_negra(rows / 2, cols / 2 + 1);
+	    img::draw_elipse_rellena(peq, Position{c.i - 2, c.j - 2}, a, b, blanco);
+	    bool ok2 = true;
+	    for (int i = 0; i < peq.rows(); ++i)
+		for (int j = 0; j < peq.cols(); ++j)
+		    if (peq(i, j) != relleno(i + 2, j + 2))
+			ok2 = false;
+	    CHECK_TRUE(ok2, "draw_elipse_rellena(recortada)");
+	}
+}
+
+
+void test_draw_image_rt()
+{
+    test::interfaz("draw_rayo, draw_circunferencia(Image_rt)");
+
+    auto blanco = img::ColorRGB::blanco();
+
+    img::Image img0 = img::imagen_negra(11, 11);
+    img::Image_rt img_rt{img0};
+
+    img::draw_circunferencia(img_rt, 3.0, blanco);
+
+    img::Image img1 = img::imagen_negra(11, 11);
+    img::draw_circunferencia(img1, img::Circulo{img_rt.centro(), 3}, blanco);
+    CHECK_TRUE(img0.size2D() == img1.size2D(), "draw_circunferencia(Image_rt)");
+    CHECK_EQUAL_CONTAINERS(img0.begin(), img0.end(), img1.begin(), img1.end(),
+    		       "draw_circunferencia(Image_rt)");
+
+    img0 = img::imagen_negra(11, 11);
+    img::draw_rayo(img_rt, 0.0, blanco);
+    img::Position c = img_rt.centro();
+    CHECK_TRUE(cuenta(img0, blanco) == static_cast<int>(img_rt.r_max()) + 1,
+	       "draw_rayo");
+    for (int k = 0; k <= img_rt.r_max(); ++k)
+	CHECK_TRUE(img0(c.i, c.j + k) == blanco, "draw_rayo");
+}
+
+
+// ¿Está el centro del pixel (i, j) dentro del polígono? Cuenta los lados
+// que cortan la fila i a la izquierda de j (o en j).
+bool dentro(const std::vector<img::Position>& ps, int i, int j,
+	    img::Regla_relleno regla)
+{
+    int cortes = 0, vueltas = 0;
+    for (size_t k = 0; k < ps.size(); ++k){
+	img::Position a = ps[k];
+	img::Position b = ps[(k + 1) % ps.size()];
+	int sentido = 1;
+	if (a.i > b.i){
+	    std::swap(a, b);
+	    sentido = -1;
+	}
+
+	if (a.i <= i and i < b.i){
+	    long long di = b.i - a.i;
+	    long long num = static_cast<long long>(a.j) * di
+			  + static_cast<long long>(i - a.i) * (b.j - a.j);
+	    if (num <= j * di){
+		++cortes;
+		vueltas += sentido;
+	    }
+	}
+    }
+
+    if (regla == img::Regla_relleno::par_impar)
+	return cortes % 2 == 1;
+    else
+	return vueltas != 0;
+}
+
+
+void test_draw_poligono()
+{
+    test::interfaz("draw_poligono_relleno, draw_relleno");
+
+    using img::Position;
+    using img::Regla_relleno;
+    auto blanco = img::ColorRGB::blanco();
+
+    {// rectángulo
+	std::vector<Position> ps{{0, 0}, {0, 4}, {3, 4}, {3, 0}};
+	img::Image img0 = img::imagen_negra(6, 6);
+	img::draw_poligono_relleno(img0, ps, blanco);
+
+	CHECK_TRUE(cuenta(img0, blanco) == 12 and img0(2, 3) == blanco and
+		   img0(3, 3) != blanco and img0(2, 4) != blanco,
+		   "draw_poligono_relleno(rectángulo)");
+    }
+
+    {// dos triángulos que comparten un lado no se pisan
+	Pincel_cuenta p{10, 10};
+	std::vector<Position> t0{{1, 1}, {1, 8}, {8, 8}};
+	std::vector<Position> t1{{1, 1}, {8, 8}, {8, 1}};
+	img::rasteriza_poligono(t0, Regla_relleno::par_impar, img::Ventana{0, 10, 0, 10}, p);
+	img::rasteriza_poligono(t1, Regla_relleno::par_impar, img::Ventana{0, 10, 0, 10}, p);
+
+	int n = 0;
+	for (int x: p.n) n += x;
+	CHECK_TRUE(p.max() == 1 and n == 7*7, "draw_triangulo_relleno(lado común)");
+
+	img::Image img0 = img::imagen_negra(10, 10);
+	img::draw_triangulo_relleno(img0, Position{1, 1}, Position{1, 8},
+				    Position{8, 8}, blanco);
+	CHECK_TRUE(cuenta(img0, blanco) == 28, "draw_triangulo_relleno");
+    }
+
+    {// estrella: el pentágono central depende de la regla
+	std::vector<Position> ps{{0, 10}, {19, 4}, {7, 19}, {7, 1}, {19, 16}};
+
+	img::Image img0 = img::imagen_negra(20, 21);
+	img::draw_poligono_relleno(img0, ps, blanco, Regla_relleno::par_impar);
+	CHECK_TRUE(img0(10, 10) != blanco and img0(3, 10) == blanco,
+		   "draw_poligono_relleno(par_impar)");
+
+	img::Image img1 = img::imagen_negra(20, 21);
+	img::draw_poligono_relleno(img1, ps, blanco, Regla_relleno::no_cero);
+	CHECK_TRUE(img1(10, 10) == blanco and img1(3, 10) == blanco,
+		   "draw_poligono_relleno(no_cero)");
+    }
+
+    // Polígonos aleatorios (se cortan a sí mismos) recortados por la
+    // imagen: los comparamos con la definición.
+    std::srand(23);
+    for (int k = 0; k < 300; ++k){
+	constexpr int rows = 30, cols = 40;
+	std::vector<Position> ps;
+	int n = 3 + std::rand() % 8;
+	for (int m = 0; m < n; ++m)
+	    ps.push_back(Position{std::rand() % 60 - 15, std::rand() % 70 - 15});
+
+	for (auto regla: {Regla_relleno::par_impar, Regla_relleno::no_cero}){
+	    img::Image img0 = img::imagen_negra(rows, cols);
+	    img::draw_poligono_relleno(img0, ps, blanco, regla);
+
+	    bool ok = true;
+	    for (int i = 0; i < rows; ++i)
+		for (int j = 0; j < cols; ++j)
+		    if ((img0(i, j) == blanco) != dentro(ps, i, j, regla))
+			ok = false;
+
+	    CHECK_TRUE(ok, "draw_poligono_relleno(aleatorio)");
+	}
+    }
+
+    {// rectángulo relleno (incluye los bordes), recortado
+	img::Image img0 = img::imagen_negra(6, 7);
+	img::draw_relleno(img0, img::Rectangulo{Position{1, 2}, Position{3, 5}},
+			  blanco);
+	CHECK_TRUE(cuenta(img0, blanco) == 3*4 and img0(1, 2) == blanco and
+		   img0(3, 5) == blanco, "draw_relleno(Rectangulo)");
+
+	img0 = img::imagen_negra(6, 7);
+	img::draw_relleno(img0, img::Rectangulo{Position{-3, 4}, Position{2, 20}},
+			  blanco);
+	CHECK_TRUE(cuenta(img0, blanco) == 3*3, "draw_relleno(recortado)");
+    }
+}
+
+
 int main()
 {
 try{
 
+    img::num_threads(4);
+
     test::header("img_draw.h");
     test_draw();
+    test_draw_segmento();
+    test_draw_segmentos();
+    test_draw_lineas();
+    test_draw_aa();
+    test_draw_grueso();
+    test_draw_circunferencia();
+    test_draw_elipse();
+    test_draw_image_rt();
+    test_draw_poligono();
 
 }catch(const std::exception& e){
     std::cerr << e.what() << '\n';
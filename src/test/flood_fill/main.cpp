@@ -0,0 +1,180 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "../../img_flood_fill.h"
+
+#include <alp_test.h>
+
+#include <iostream>
+
+using namespace test;
+
+// Imagen con una espiral negra sobre fondo blanco
+static img::Image espiral(int n)
+{
+    img::Image img0{n, n};
+    std::fill(img0.begin(), img0.end(), img::ColorRGB::blanco());
+
+    // anillos cuadrados concéntricos, cada uno con un hueco
+    for (int k = 0; 2*k < n; k += 2){
+	for (int t = k; t < n - k; ++t){
+	    img0(k, t) = img0(n - 1 - k, t) = img::ColorRGB::negro();
+	    img0(t, k) = img0(t, n - 1 - k) = img::ColorRGB::negro();
+	}
+	if (k + 1 < n - k)
+	    img0(k, k + 1) = img::ColorRGB::blanco(); // hueco
+    }
+
+    return img0;
+}
+
+void test_rellena()
+{
+    test::interfaz("rellena");
+
+    int n = 41;
+    img::Image img0 = espiral(n);
+
+    // cuento los blancos con las componentes conexas
+    auto cc = img::componentes_conexas(img0, img::Conectividad::cuatro,
+		[](const img::ColorRGB& a, const img::ColorRGB& b)
+		{ return a == b; });
+
+    img::Position semilla{n/2, n/2};
+    int k = cc.etiqueta(semilla);
+
+    auto r = img::rellena(img0, semilla, img::ColorRGB::rojo());
+
+    CHECK_TRUE(r.npixels == cc.componentes[k].npixels, "npixels");
+    CHECK_TRUE(r.p0 == cc.componentes[k].p0, "p0");
+    CHECK_TRUE(r.pe == cc.componentes[k].pe, "pe");
+
+    bool ok = true;
+    for (int i = 0; i < n; ++i)
+	for (int j = 0; j < n; ++j){
+	    bool en_region = (cc.etiqueta(i, j) == k);
+	    if (en_region != (img0(i, j) == img::ColorRGB::rojo()))
+		ok = false;
+	}
+    CHECK_TRUE(ok, "rellena");
+
+    // Volver a rellenar del mismo color no hace nada (y termina)
+    auto r2 = img::rellena(img0, semilla, img::ColorRGB::rojo());
+    CHECK_TRUE(r2.npixels == r.npixels, "rellena mismo color");
+}
+
+
+// Regiones con muchos tramos por fila
+void test_ruido()
+{
+    test::interfaz("rellena(ruido)");
+
+    int n = 200;
+    img::Image img0{n, n};
+    unsigned x = 12345;
+    for (auto& p: img0){
+	x = x * 1103515245u + 12345u;
+	p = ((x >> 16) % 100 < 55)? img::ColorRGB::blanco(): img::ColorRGB::negro();
+    }
+
+    for (auto con: {img::Conectividad::cuatro, img::Conectividad::ocho}){
+	img::Image img1 = img0;
+	auto cc = img::componentes_conexas(img1, con,
+		    [](const img::ColorRGB& a, const img::ColorRGB& b)
+		    { return a == b; });
+
+	// La semilla en la componente más grande
+	std::size_t k = 0;
+	for (std::size_t c = 1; c < cc.componentes.size(); ++c)
+	    if (cc.componentes[c].npixels > cc.componentes[k].npixels)
+		k = c;
+	img::Position semilla{0, 0};
+	for (int i = 0; i < n; ++i)
+	    for (int j = 0; j < n; ++j)
+		if (cc.etiqueta(i, j) == static_cast<int>(k))
+		    semilla = img::Position{i, j};
+
+	auto r = img::rellena(img1, semilla, img::ColorRGB::rojo(), con);
+	CHECK_TRUE(r.npixels == cc.componentes[k].npixels, "npixels");
+
+	bool ok = true;
+	for (int i = 0; i < n; ++i)
+	    for (int j = 0; j < n; ++j)
+		if ((cc.etiqueta(i, j) == static_cast<int>(k)) != 
+				    (img1(i, j) == img::ColorRGB::rojo()))
+		    ok = false;
+	CHECK_TRUE(ok, "rellena");
+    }
+}
+
+
+void test_crece_region()
+{
+    test::interfaz("crece_region");
+
+    // Diagonal: con 4-conectividad son pixeles sueltos, con 8 no.
+    img::Image img0 = img::Image{5, 5};
+    std::fill(img0.begin(), img0.end(), img::ColorRGB::blanco());
+    for (int i = 0; i < 5; ++i)
+	img0(i, i) = img::ColorRGB::negro();
+
+    auto es_negro = [](const img::ColorRGB& c){ return img::es_negro(c); };
+
+    img::Plane<int> mask{5, 5};
+    std::fill(mask.begin(), mask.end(), 0);
+    auto marca = [&](img::Ind i, img::Ind j0, img::Ind je){
+	for (img::Ind j = j0; j < je; ++j) ++mask(i, j);
+    };
+
+    auto r4 = img::crece_region(img0, img::Position{2, 2}, es_negro, marca);
+    CHECK_TRUE(r4.npixels == 1, "cuatro");
+
+    std::fill(mask.begin(), mask.end(), 0);
+    img::Iterator2D p{img0, img::Position{0, 0}};
+    auto r8 = img::crece_region(p, es_negro, marca,
+				img::Conectividad::ocho);
+    CHECK_TRUE(r8.npixels == 5, "ocho");
+    CHECK_TRUE((r8.p0 == img::Position{0, 0}), "p0");
+    CHECK_TRUE((r8.pe == img::Position{4, 4}), "pe");
+
+    bool ok = true;	// cada pixel se marca una sola vez
+    for (int i = 0; i < 5; ++i)
+	for (int j = 0; j < 5; ++j)
+	    if (mask(i, j) != (i == j? 1: 0)) ok = false;
+    CHECK_TRUE(ok, "accion");
+
+    auto r0 = img::crece_region(img0, img::Position{0, 1}, es_negro, marca);
+    CHECK_TRUE(r0.npixels == 0, "semilla fuera de la región");
+}
+
+int main()
+{
+try{
+
+    test::header("img_flood_fill.h");
+    test_rellena();
+    test_ruido();
+    test_crece_region();
+
+}catch(const std::exception& e){
+    std::cerr << e.what() << '\n';
+    return 1;
+}
+
+    return 0;
+}
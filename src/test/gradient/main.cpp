@@ -0,0 +1,145 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "../../img_gradient.h"
+#include "../../img_algorithm.h"
+
+#include <alp_test.h>
+
+#include <iostream>
+#include <cmath>
+
+using namespace test;
+
+// Valor de x(i, j) repitiendo los bordes
+static int en(const img::Plane<int>& x, int i, int j)
+{
+    i = std::clamp(i, 0, x.rows() - 1);
+    j = std::clamp(j, 0, x.cols() - 1);
+    return x(i, j);
+}
+
+// Gradientes calculados a lo bruto
+static int gx(const img::Plane<int>& x, int i, int j, int w0, int w1)
+{
+    return w0 * (en(x, i-1, j+1) - en(x, i-1, j-1))
+	 + w1 * (en(x, i  , j+1) - en(x, i  , j-1))
+	 + w0 * (en(x, i+1, j+1) - en(x, i+1, j-1));
+}
+
+static int gy(const img::Plane<int>& x, int i, int j, int w0, int w1)
+{
+    return w0 * (en(x, i+1, j-1) - en(x, i-1, j-1))
+	 + w1 * (en(x, i+1, j  ) - en(x, i-1, j  ))
+	 + w0 * (en(x, i+1, j+1) - en(x, i-1, j+1));
+}
+
+void test_gradiente(int rows, int cols)
+{
+    test::interfaz("gradiente");
+
+    img::Image img0{rows, cols};
+    for (int i = 0; i < img0.rows(); ++i)
+	for (int j = 0; j < img0.cols(); ++j)
+	    img0(i,j) = img::ColorRGB{(7*i*i + 3*j + i*j) % 256, 0, 0};
+
+    auto x = img::plano_int(img::const_imagen_red(img0));
+    CHECK_TRUE(x.rows() == rows and x.cols() == cols, "plano_int");
+
+    struct Caso{ img::Tipo_gradiente tipo; int w0, w1; const char* nombre;};
+    for (auto caso: {Caso{img::Tipo_gradiente::centrales, 0, 1, "centrales"},
+		     Caso{img::Tipo_gradiente::sobel, 1, 2, "sobel"},
+		     Caso{img::Tipo_gradiente::scharr, 3, 10, "scharr"}}){
+
+	auto g = img::gradiente(img::const_imagen_red(img0), caso.tipo);
+
+	bool ok = true;
+	for (int i = 0; i < rows; ++i)
+	    for (int j = 0; j < cols; ++j){
+		if (g.x(i, j) != gx(x, i, j, caso.w0, caso.w1)) ok = false;
+		if (g.y(i, j) != gy(x, i, j, caso.w0, caso.w1)) ok = false;
+	    }
+
+	CHECK_TRUE(ok, caso.nombre);
+    }
+
+    {// diferencias: tiene que coincidir con It_diferencias_x
+	auto g = img::gradiente(x, img::Tipo_gradiente::diferencias);
+
+	bool ok = true;
+	for (int i = 0; i < rows; ++i){
+	    auto q = &g.x(i, 1);
+	    for (auto p = img::diferencias_x_B(x, i);
+		      p != img::diferencias_x_E(x); ++p, ++q)
+		if (*p != *q) ok = false;
+
+	    if (g.x(i, 0) != 0) ok = false;
+	}
+	CHECK_TRUE(ok, "diferencias x");
+
+	ok = true;
+	for (int i = 0; i < rows; ++i)
+	    for (int j = 0; j < cols; ++j)
+		if (g.y(i, j) != x(i, j) - en(x, i-1, j)) ok = false;
+	CHECK_TRUE(ok, "diferencias y");
+    }
+}
+
+
+void test_magnitud()
+{
+    test::interfaz("magnitud/orientacion");
+
+    img::Plane<int> gx{1, 4}, gy{1, 4};
+    gx(0,0) = 3; gy(0,0) = 4;
+    gx(0,1) = 0; gy(0,1) = -5;  // la y crece hacia abajo: 90 grados
+    gx(0,2) = -2; gy(0,2) = 0;
+    gx(0,3) = 0; gy(0,3) = 0;
+
+    auto m = img::magnitud(gx, gy);
+    CHECK_TRUE(std::abs(m(0,0) - 5.0f) < 1e-5f, "magnitud");
+    CHECK_TRUE(std::abs(m(0,1) - 5.0f) < 1e-5f, "magnitud");
+
+    auto m1 = img::magnitud_L1(gx, gy);
+    CHECK_TRUE(m1(0,0) == 7 and m1(0,1) == 5 and m1(0,2) == 2, "magnitud_L1");
+
+    auto th = img::orientacion(gx, gy);
+    CHECK_TRUE(std::abs(th(0,1) - 90.0f) < 1e-4f, "orientacion");
+    CHECK_TRUE(std::abs(th(0,2) - 180.0f) < 1e-4f, "orientacion");
+    CHECK_TRUE(th(0,3) == 0.0f, "orientacion");
+}
+
+int main()
+{
+try{
+
+    test::header("img_gradient.h");
+    test_gradiente(1, 1);
+    test_gradiente(1, 7);
+    test_gradiente(9, 1);
+    test_gradiente(17, 23);
+    test_gradiente(400, 500);   // en paralelo
+    test_magnitud();
+
+}catch(const std::exception& e){
+    std::cerr << e.what() << '\n';
+    return 1;
+}
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "../../img_grid.h"
+
+#include <alp_test.h>
+
+#include <iostream>
+#include <cmath>
+
+using namespace test;
+
+void test_estadisticas(int rows, int cols, int m, int n)
+{
+    test::interfaz("estadisticas");
+
+    img::Image img0{rows, cols};
+    for (int i = 0; i < img0.rows(); ++i)
+	for (int j = 0; j < img0.cols(); ++j)
+	    img0(i,j) = img::ColorRGB{(5*i + 3*j) % 256, (i*j) % 256, i % 7};
+
+    const img::Image& cimg0 = img0;
+    auto g = img::grid(cimg0, m, n);
+    auto st = img::estadisticas(g, img::const_Color_red{});
+    auto strgb = img::estadisticasRGB(g);
+
+    CHECK_TRUE(st.rows() == rows / m and st.cols() == cols / n, "size");
+
+    for (int I = 0; I < st.rows(); ++I)
+	for (int J = 0; J < st.cols(); ++J){
+	    // Lo calculamos a lo bruto
+	    long long suma = 0, suma2 = 0;
+	    int mn = 1000, mx = -1;
+	    long long suma_g = 0;
+	    for (int i = I*m; i < (I+1)*m; ++i)
+		for (int j = J*n; j < (J+1)*n; ++j){
+		    int x = img0(i, j).r;
+		    suma += x;
+		    suma2 += x*x;
+		    mn = std::min(mn, x);
+		    mx = std::max(mx, x);
+		    suma_g += img0(i,j).g;
+		}
+
+	    const auto& e = st(I, J);
+	    CHECK_TRUE(e.n == m*n, "n");
+	    CHECK_TRUE(e.suma == suma, "suma");
+	    CHECK_TRUE(e.suma2 == suma2, "suma2");
+	    CHECK_TRUE(e.min == mn, "min");
+	    CHECK_TRUE(e.max == mx, "max");
+
+	    double media = double(suma)/(m*n);
+	    CHECK_TRUE(std::abs(e.media() - media) < 1e-9, "media");
+	    CHECK_TRUE(std::abs(e.varianza() - (double(suma2)/(m*n) - media*media))
+			< 1e-6, "varianza");
+
+	    CHECK_TRUE(strgb(I, J).r.suma == suma, "estadisticasRGB.r");
+	    CHECK_TRUE(strgb(I, J).g.suma == suma_g, "estadisticasRGB.g");
+	    CHECK_TRUE(strgb(I, J).media().r == suma/(m*n), "media()");
+	}
+}
+
+int main()
+{
+try{
+
+    test::header("img_grid.h");
+    test_estadisticas(20, 30, 4, 5);
+    test_estadisticas(23, 31, 4, 5);	    // sobran pixeles
+    test_estadisticas(600, 700, 16, 16); // en paralelo
+
+}catch(const std::exception& e){
+    std::cerr << e.what() << '\n';
+    return 1;
+}
+
+    return 0;
+}
@@ -0,0 +1,140 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "../../img_integral.h"
+
+#include <alp_test.h>
+
+#include <iostream>
+#include <cmath>
+
+using namespace test;
+
+// Sumas calculadas a lo bruto, para comparar
+static long long suma_red(const img::Image& img0, img::Position p0, img::Position pe)
+{
+    long long s = 0;
+    for (int i = p0.i; i <= pe.i; ++i)
+	for (int j = p0.j; j <= pe.j; ++j)
+	    s += img0(i, j).r;
+
+    return s;
+}
+
+static long long suma2_red(const img::Image& img0, img::Position p0, img::Position pe)
+{
+    long long s = 0;
+    for (int i = p0.i; i <= pe.i; ++i)
+	for (int j = p0.j; j <= pe.j; ++j)
+	    s += img0(i, j).r * img0(i, j).r;
+
+    return s;
+}
+
+void test_integral_image(int rows, int cols)
+{
+    test::interfaz("Integral_image");
+
+    img::Image img0{rows, cols};
+    for (int i = 0; i < img0.rows(); ++i)
+	for (int j = 0; j < img0.cols(); ++j)
+	    img0(i,j) = img::ColorRGB{(7*i + 3*j) % 256, (i*j) % 256, 255};
+
+    img::Integral_image S{img::const_imagen_red(img0), true};
+
+    CHECK_TRUE(S.rows() == rows and S.cols() == cols, "rows/cols");
+    CHECK_TRUE(S.con_cuadrados(), "con_cuadrados");
+
+    int di = std::max(3, rows / 8);
+    int dj = std::max(5, cols / 8);
+    for (int i0 = 0; i0 < rows; i0 += di)
+	for (int j0 = 0; j0 < cols; j0 += dj)
+	    for (int ie = i0; ie < rows; ie += di + 4)
+		for (int je = j0; je < cols; je += dj + 6){
+		    img::Position p0{i0, j0}, pe{ie, je};
+		    CHECK_TRUE(S.suma(p0, pe) == suma_red(img0, p0, pe), "suma");
+		    CHECK_TRUE(S.suma_cuadrados(p0, pe) == suma2_red(img0, p0, pe),
+				"suma_cuadrados");
+		}
+
+    img::Position p0{1, 2}, pe{rows - 1, cols - 1};
+    double n = img::Integral_image::area(p0, pe);
+    double m = suma_red(img0, p0, pe) / n;
+    double v = suma2_red(img0, p0, pe) / n - m*m;
+
+    CHECK_TRUE(std::abs(S.media(p0, pe) - m) < 1e-9, "media");
+    CHECK_TRUE(std::abs(S.varianza(p0, pe) - v) < 1e-6, "varianza");
+    CHECK_TRUE(S.suma(p0, img::Size2D{2, 3}) == 
+		    suma_red(img0, p0, img::Position{2, 4}), "suma(Size2D)");
+    CHECK_TRUE(S.suma(img::Rectangulo{p0, pe}) == suma_red(img0, p0, pe),
+		    "suma(Rectangulo)");
+
+    {// sin cuadrados
+	img::Integral_image S1{img0, img::const_Color_green{}};
+	CHECK_TRUE(!S1.con_cuadrados(), "con_cuadrados");
+	CHECK_TRUE(S1.suma(img::Position{0,0}, img::Position{rows-1, cols-1}) ==
+		   S1.suma(img::Position{0,0}, img::Size2D{rows, cols}), "suma");
+
+	bool lanza = false;
+	try{ S1.varianza(p0, pe); }
+	catch(const std::logic_error&) { lanza = true; }
+	CHECK_TRUE(lanza, "varianza sin cuadrados");
+    }
+}
+
+
+void test_integral_imageRGB()
+{
+    test::interfaz("Integral_imageRGB");
+
+    img::Image img0 = img::imagen_monocolor(40, 50, img::ColorRGB{10, 20, 30});
+
+    img::Subimage sb{img0, img::Position{10, 10}, img::Size2D{5, 5}};
+    std::fill(sb.begin(), sb.end(), img::ColorRGB{110, 120, 130});
+
+    img::Integral_imageRGB S{img0};
+    CHECK_TRUE((S.media(img::Position{10, 10}, img::Size2D{5, 5}) == 
+				img::ColorRGB{110, 120, 130}), "media");
+    CHECK_TRUE((S.media(img::Position{0, 0}, img::Size2D{5, 5}) == 
+				img::ColorRGB{10, 20, 30}), "media");
+    CHECK_TRUE((S.media(img::Position{10, 10}, img::Size2D{5, 10}) == 
+				img::ColorRGB{60, 70, 80}), "media");
+
+    // Sobre una subimagen
+    img::Integral_imageRGB Ssb{sb};
+    CHECK_TRUE(Ssb.rows() == 5 and Ssb.cols() == 5, "Subimage");
+    CHECK_TRUE((Ssb.media(img::Position{0, 0}, img::Size2D{5, 5}) == 
+				img::ColorRGB{110, 120, 130}), "Subimage");
+}
+
+int main()
+{
+try{
+
+    test::header("img_integral.h");
+    test_integral_image(23, 31);
+    test_integral_image(512, 640); // construcción en paralelo
+    test_integral_imageRGB();
+
+}catch(const std::exception& e){
+    std::cerr << e.what() << '\n';
+    return 1;
+}
+
+    return 0;
+}
@@ -0,0 +1,175 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "../../img_lut.h"
+#include "../../img_view.h"
+
+#include <alp_test.h>
+
+#include <iostream>
+#include <vector>
+#include <stdexcept>
+
+using namespace test;
+
+using img::ColorRGB;
+using img::LUT;
+
+
+void test_lut()
+{
+    test::interfaz("LUT");
+
+    LUT id;
+    bool ok = true;
+    for (int x = 0; x < 256; ++x)
+	if (id[x] != x)
+	    ok = false;
+    CHECK_TRUE(ok, "LUT()");
+    CHECK_TRUE(id(-7) == 0 and id(300) == 255, "operator()");
+
+    LUT b = LUT::brillo(50);
+    CHECK_TRUE(b[0] == 50 and b[100] == 150 and b[250] == 255, "brillo");
+
+    LUT c = LUT::contraste(2.0);
+    CHECK_TRUE(c[128] == 128 and c[100] == 72 and c[10] == 0 and c[200] == 255,
+	       "contraste");
+
+    LUT g = LUT::gamma(2.0);
+    CHECK_TRUE(g[0] == 0 and g[255] == 255 and g[64] == 128, "gamma");
+
+    bool lanza = false;
+    try{ LUT::gamma(0.0); }
+    catch(const std::logic_error&) { lanza = true; }
+    CHECK_TRUE(lanza, "gamma(0)");
+
+    LUT n = LUT::niveles(50, 200);
+    CHECK_TRUE(n[0] == 0 and n[50] == 0 and n[125] == 128 and n[200] == 255
+	       and n[230] == 255, "niveles");
+
+    n = LUT::niveles(0, 255, 1.0, 100, 200);
+    CHECK_TRUE(n[0] == 100 and n[255] == 200, "niveles(salida)");
+
+    lanza = false;
+    try{ LUT::niveles(0, 255, -1.0); }
+    catch(const std::logic_error&) { lanza = true; }
+    CHECK_TRUE(lanza, "niveles(gamma negativa)");
+
+    std::vector<std::pair<int, int>> ps = {{50, 0}, {100, 200}, {200, 255}};
+    LUT cv = LUT::curva(ps);
+    CHECK_TRUE(cv[0] == 0 and cv[75] == 100 and cv[100] == 200 and
+	       cv[150] == 228 and cv[255] == 255, "curva");
+
+    CHECK_TRUE(LUT::invierte()[0] == 255 and LUT::invierte()[55] == 200,
+	       "invierte");
+
+    LUT e = img::encadena({LUT::brillo(10), LUT::invierte(), LUT::brillo(-5)});
+    ok = true;
+    for (int x = 0; x < 256; ++x)
+	if (e[x] != std::clamp(255 - std::min(x + 10, 255) - 5, 0, 255))
+	    ok = false;
+    CHECK_TRUE(ok, "encadena");
+}
+
+
+void test_aplica()
+{
+    test::interfaz("aplica");
+
+    // Cada canal recorre todo el rango [0, 255] para probar todas las
+    // entradas de las tablas
+    img::Image img0{150, 130};
+    for (int i = 0; i < 150; ++i)
+	for (int j = 0; j < 130; ++j)
+	    img0(i, j) = ColorRGB{(i * 7) % 256, (j * 3) % 256, (i + j) % 256};
+    img0(3, 4) = ColorRGB{-20, 400, 7};
+
+    LUT t = img::encadena({LUT::brillo(20), LUT::contraste(1.3),
+			   LUT::gamma(1.4), LUT::niveles(10, 240),
+			   LUT::invierte()});
+
+    // Equivale a aplicar los ajustes uno a uno
+    img::Image img1 = img0;
+    for (const LUT& x: {LUT::brillo(20), LUT::contraste(1.3),
+			LUT::gamma(1.4), LUT::niveles(10, 240), LUT::invierte()})
+	for (auto& p: img1)
+	    p = ColorRGB{x(p.r), x(p.g), x(p.b)};
+
+    img::Image img2 = img0;
+    img::aplica(t, img2);
+    CHECK_TRUE(img1.size2D() == img2.size2D(), "aplica(LUT)");
+    CHECK_EQUAL_CONTAINERS(img1.begin(), img1.end(), img2.begin(), img2.end(),
+			   "aplica(LUT)");
+
+    // Una tabla por canal
+    img::LUT_rgb t3{LUT::invierte(), LUT{}, LUT::brillo(-100)};
+    img2 = img0;
+    img::aplica(t3, img2);
+    {
+	bool ok = true;
+	for (int i = 0; i < img0.rows(); ++i)
+	    for (int j = 0; j < img0.cols(); ++j)
+		if (!(img2(i, j) == t3(img0(i, j))))
+		    ok = false;
+	CHECK_TRUE(ok, "aplica(LUT_rgb)");
+    }
+
+    // Subimage
+    img2 = img0;
+    img::Subimage sb{img2, img::Position{10, 20}, img::Size2D{30, 40}};
+    img::aplica(t, sb);
+    CHECK_TRUE(img2(9, 20) == img0(9, 20) and img2(10, 19) == img0(10, 19) and
+	       img2(10, 20) == img1(10, 20) and img2(39, 59) == img1(39, 59) and
+	       img2(40, 59) == img0(40, 59), "aplica(Subimage)");
+
+    // Vista de un canal
+    img2 = img0;
+    img::aplica(t, img::imagen_green(img2));
+    CHECK_TRUE(img2(5, 6).g == t(img0(5, 6).g) and
+	       img2(5, 6).r == img0(5, 6).r and img2(5, 6).b == img0(5, 6).b,
+	       "aplica(imagen_green)");
+
+    // Plano
+    img::Plane<int> p{20, 30};
+    for (int i = 0; i < 20; ++i)
+	for (int j = 0; j < 30; ++j)
+	    p(i, j) = i * 30 + j - 100;
+    img::aplica(LUT::invierte(), p);
+    CHECK_TRUE(p(0, 0) == 255 and p(5, 10) == 195 and p(19, 29) == 0,
+	       "aplica(Plane)");
+}
+
+
+
+int main()
+{
+try{
+
+    test::header("img_lut.h");
+    img::num_threads(4);
+
+    test_lut();
+    test_aplica();
+
+}catch(const std::exception& e){
+    std::cerr << e.what() << '\n';
+    return 1;
+}
+
+    return 0;
+}
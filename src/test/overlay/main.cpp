@@ -0,0 +1,185 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "../../img_overlay.h"
+#include "../../img_parallel.h"
+
+#include <alp_test.h>
+
+#include <iostream>
+
+using namespace test;
+
+void test_capa()
+{
+    test::interfaz("Capa");
+
+    img::Capa capa{150, 200};
+    CHECK_TRUE(capa.rows() == 150 and capa.cols() == 200, "Capa(rows, cols)");
+    CHECK_TRUE(capa.vacia() and capa.num_teselas() == 0, "Capa(vacia)");
+    CHECK_TRUE(capa(10, 10).a == 0, "Capa(transparente)");
+
+    // Solo se crean las teselas en las que se pinta
+    capa.pinta(10, 60, 70, img::ColorRGB{10, 20, 30}, 255);
+    CHECK_TRUE(capa.num_teselas() == 2, "pinta(tramo)");
+    CHECK_TRUE(capa(10, 63).r == 10 and capa(10, 64).g == 20 and
+	       capa(10, 69).a == 255 and capa(10, 70).a == 0, "pinta(tramo)");
+
+    img::Ventana w = capa.zona_sucia();
+    CHECK_TRUE(!capa.vacia() and w.i0 == 10 and w.ie == 11 and w.j0 == 60
+	       and w.je == 70, "zona_sucia");
+
+    capa.pinta(140, 5, img::ColorRGB::blanco(), 100);
+    w = capa.zona_sucia();
+    CHECK_TRUE(w.i0 == 10 and w.ie == 141 and w.j0 == 5 and w.je == 70,
+	       "zona_sucia");
+    CHECK_TRUE(capa.num_teselas() == 3, "pinta(punto)");
+
+    // Composición dentro de la capa
+    capa.pinta(140, 5, img::ColorRGB::negro(), 100);
+    img::Pixel_capa p = capa(140, 5);
+    // alfa = 100 + 100 * 155/255 = 160.8
+    CHECK_TRUE(p.a == 161, "pinta(over)");
+    // color = (0*100*255 + 255*100*155) / (160.8*255) = 96.4
+    CHECK_TRUE(p.r == 96, "pinta(over)");
+
+    capa.limpia();
+    CHECK_TRUE(capa.vacia() and capa.num_teselas() == 0 and capa(10, 63).a == 0,
+	       "limpia");
+}
+
+
+void test_compone()
+{
+    test::interfaz("compone");
+
+    using img::Segmento;
+    using img::Position;
+
+    // Fondo no uniforme: cada pixel distinto de sus vecinos
+    img::Image base{150, 200};
+    for (int i = 0; i < 150; ++i)
+	for (int j = 0; j < 200; ++j)
+	    base(i, j) = img::ColorRGB{i, j, 255 - i};
+
+    {// capa vacía: no cambia nada
+	img::Capa capa{150, 200};
+	img::Image img0 = base;
+	img::compone(capa, img0);
+	CHECK_TRUE(img0.size2D() == base.size2D(), "compone(vacía)");
+	CHECK_EQUAL_CONTAINERS(img0.begin(), img0.end(), base.begin(), base.end(),
+			       "compone(vacía)");
+    }
+
+    {// opaca: igual que dibujar en la imagen
+	img::Capa capa{150, 200};
+	img::Image img0 = base;
+	img::Image img1 = base;
+
+	img::draw(capa, Segmento{Position{-10, -10}, Position{170, 230}},
+		  img::ColorRGB::rojo());
+	img::draw(img1, Segmento{Position{-10, -10}, Position{170, 230}},
+		  img::ColorRGB::rojo());
+
+	img::draw_circulo(capa, img::Circulo{Position{100, 30}, 20},
+			  img::ColorRGB::verde());
+	img::draw_circulo(img1, img::Circulo{Position{100, 30}, 20},
+			  img::ColorRGB::verde());
+
+	img::draw_aa(capa, Segmento{Position{0, 199}, Position{149, 50}},
+		     img::ColorRGB::blanco());
+	img::draw_aa(img1, Segmento{Position{0, 199}, Position{149, 50}},
+		     img::ColorRGB::blanco());
+
+	img::compone(capa, img0);
+	CHECK_TRUE(img0.size2D() == img1.size2D(), "compone(opaca)");
+	CHECK_EQUAL_CONTAINERS(img0.begin(), img0.end(), img1.begin(), img1.end(),
+			       "compone(opaca)");
+    }
+
+    {// semitransparente
+	img::Capa capa{150, 200};
+	img::Image img0 = base;
+	img::draw_relleno(capa, img::Rectangulo{Position{20, 20}, Position{30, 180}},
+			  img::ColorRGB::blanco(), 128);
+	img::compone(capa, img0);
+
+	bool ok = true;
+	for (int i = 0; i < 150; ++i)
+	    for (int j = 0; j < 200; ++j){
+		bool dentro = (20 <= i and i <= 30 and 20 <= j and j <= 180);
+		img::ColorRGB c = dentro? img::mezcla(base(i, j),
+						img::ColorRGB::blanco(), 128)
+					: base(i, j);
+		if (img0(i, j) != c)
+		    ok = false;
+	    }
+	CHECK_TRUE(ok, "compone(alfa)");
+    }
+
+    {// rectángulo semitransparente: las esquinas no se pintan dos veces
+	img::Capa capa{20, 20};
+	img::draw(capa, img::Rectangulo{Position{2, 3}, Position{10, 12}},
+		  img::ColorRGB::blanco(), 100);
+	CHECK_TRUE(capa(2, 3).a == 100 and capa(10, 12).a == 100 and
+		   capa(2, 12).a == 100 and capa(6, 3).a == 100 and
+		   capa(6, 6).a == 0, "draw(Capa, Rectangulo)");
+    }
+
+    {// sobre una Subimage
+	img::Image img0 = base;
+	img::Subimage sb{img0, Position{30, 40}, img::Size2D{80, 100}};
+
+	img::Capa capa{80, 100};
+	img::draw_grueso(capa, Segmento{Position{0, 0}, Position{79, 99}}, 5,
+			 img::ColorRGB::azul());
+	img::compone(capa, sb);
+
+	img::Image img1 = base;
+	img::Subimage sb1{img1, Position{30, 40}, img::Size2D{80, 100}};
+	img::Pincel<img::Subimage> pincel{sb1, img::ColorRGB::azul()};
+	img::rasteriza_grueso(Segmento{Position{0, 0}, Position{79, 99}}, 5,
+			      img::Extremo::redondo, img::Ventana{0, 80, 0, 100},
+			      pincel);
+
+	CHECK_TRUE(img0.size2D() == img1.size2D(), "compone(Subimage)");
+	CHECK_EQUAL_CONTAINERS(img0.begin(), img0.end(), img1.begin(), img1.end(),
+			       "compone(Subimage)");
+	CHECK_TRUE(img0(30, 40) == img::ColorRGB::azul() and
+		   img0(29, 39) == base(29, 39), "compone(Subimage)");
+    }
+}
+
+
+int main()
+{
+try{
+
+    img::num_threads(4);
+
+    test::header("img_overlay.h");
+    test_capa();
+    test_compone();
+
+}catch(const std::exception& e){
+    std::cerr << e.what() << '\n';
+    return 1;
+}
+
+    return 0;
+}
@@ -0,0 +1,176 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "../../img_padded.h"
+#include "../../img_iterator2D.h"
+
+#include <alp_test.h>
+
+#include <iostream>
+
+using namespace test;
+
+using img::ColorRGB;
+using img::Ind;
+using img::Relleno_borde;
+
+
+void test_relleno()
+{
+    test::interfaz("Image_con_borde");
+
+    // Cada pixel distinto: se ve de dónde sale cada valor del borde
+    img::Image img0{5, 6};
+    for (int i = 0; i < 5; ++i)
+	for (int j = 0; j < 6; ++j)
+	    img0(i, j) = ColorRGB{i, j, 10 * i + j};
+
+    {// replica
+	img::Image_con_borde img1{img0, 2};
+	CHECK_TRUE(img1.rows() == 5 and img1.cols() == 6 and img1.borde() == 2
+		   and img1.salto_fila() == 10, "dimensiones");
+
+	bool ok = true;
+	for (Ind i = -2; i < 7; ++i)
+	    for (Ind j = -2; j < 8; ++j)
+		if (img1(i, j) != img0(std::clamp(i, 0, 4), std::clamp(j, 0, 5)))
+		    ok = false;
+	CHECK_TRUE(ok, "replica");
+    }
+
+    {// constante
+	ColorRGB x{1, 2, 3};
+	img::Image_con_borde img1{img0, 1, Relleno_borde::constante, x};
+	CHECK_TRUE(img1(-1, -1) == x and img1(-1, 3) == x and img1(5, 6) == x
+		   and img1(2, -1) == x and img1(2, 6) == x, "constante");
+	CHECK_TRUE(img1(0, 0) == img0(0, 0) and img1(4, 5) == img0(4, 5),
+							    "constante");
+    }
+
+    {// espejo: c b | a b c d e | d c
+	img::Image_con_borde img1{img0, 2, Relleno_borde::espejo};
+	CHECK_TRUE(img1(-1, 0) == img0(1, 0) and img1(-2, 0) == img0(2, 0) and
+		   img1(5, 3) == img0(3, 3) and img1(6, 3) == img0(2, 3),
+								"espejo(filas)");
+	CHECK_TRUE(img1(0, -2) == img0(0, 2) and img1(0, 7) == img0(0, 3),
+							    "espejo(columnas)");
+	CHECK_TRUE(img1(-2, -1) == img0(2, 1) and img1(6, 7) == img0(2, 3),
+							    "espejo(esquinas)");
+    }
+
+    {// espejo con borde mayor que la imagen
+	img::Plane<int> p{2, 3};
+	int n = 0;
+	for (Ind i = 0; i < 2; ++i)
+	    for (Ind j = 0; j < 3; ++j)
+		p(i, j) = n++;
+
+	img::Plane_con_borde<int> p1{p, 5, Relleno_borde::espejo};
+	// columnas: 0 1 2 1 0 1 2 1 ...
+	CHECK_TRUE(p1(0, 3) == 1 and p1(0, 4) == 0 and p1(0, 5) == 1 and
+		   p1(0, -4) == 0 and p1(0, -5) == 1, "espejo(borde grande)");
+	// filas: 0 1 0 1 ...
+	CHECK_TRUE(p1(2, 0) == 0 and p1(3, 0) == 3 and p1(-5, 2) == 5,
+						    "espejo(borde grande)");
+    }
+
+    {// interior + rellena_borde
+	img::Image_con_borde img1{img0, 1};
+	img1.interior()(0, 0) = ColorRGB{100, 100, 100};
+	CHECK_TRUE(img1(-1, -1) == img0(0, 0), "interior");
+	img1.rellena_borde();
+	CHECK_TRUE(img1(-1, -1) == (ColorRGB{100, 100, 100}), "rellena_borde");
+    }
+
+    {// Sin borde
+	img::Image_con_borde img1{img0, 0};
+	CHECK_TRUE(img1.salto_fila() == 6 and img1(4, 5) == img0(4, 5), "k = 0");
+    }
+
+    bool lanza = false;
+    try{ img::Image_con_borde img1{img::Size2D{2, 2}, -1}; }
+    catch(const std::logic_error&) { lanza = true; }
+    CHECK_TRUE(lanza, "k < 0");
+}
+
+
+void test_vecinos()
+{
+    test::interfaz("vecinos sin comprobaciones");
+
+    img::Plane<int> p{40, 50};
+    for (Ind i = 0; i < p.rows(); ++i)
+	for (Ind j = 0; j < p.cols(); ++j)
+	    p(i, j) = (i * 31 + j * 17) % 97;
+
+    // Suma de los 3 x 3 vecinos (repitiendo el borde)
+    img::Plane_con_borde<int> pb{p, 1};
+    img::Plane<int> res{p.rows(), p.cols()};
+    Ind s = pb.salto_fila();
+    for (Ind i = 0; i < p.rows(); ++i){
+	const int* a = pb.fila(i);
+	for (Ind j = 0; j < p.cols(); ++j)
+	    res(i, j) = a[j - s - 1] + a[j - s] + a[j - s + 1] +
+			a[j - 1]     + a[j]	+ a[j + 1] + 
+			a[j + s - 1] + a[j + s] + a[j + s + 1];
+    }
+
+    bool ok = true;
+    for (Ind i = 0; i < p.rows(); ++i)
+	for (Ind j = 0; j < p.cols(); ++j){
+	    int suma = 0;
+	    for (Ind di = -1; di <= 1; ++di)
+		for (Ind dj = -1; dj <= 1; ++dj)
+		    suma += p(std::clamp(i + di, 0, p.rows() - 1),
+			      std::clamp(j + dj, 0, p.cols() - 1));
+	    if (suma != res(i, j))
+		ok = false;
+	}
+    CHECK_TRUE(ok, "suma 3 x 3");
+
+    // Iterator2D puede salirse del borde
+    img::Image img0{3, 4};
+    for (int i = 0; i < 3; ++i)
+	for (int j = 0; j < 4; ++j)
+	    img0(i, j) = ColorRGB{i, j, 10 * i + j};
+    img::Image_con_borde img1{img0, 1};
+    img::Iterator2D_t<img::Image_con_borde> it{img1, img::Position{0, 3}};
+    it.dcha();
+    CHECK_TRUE(it.esta_fuera() and *it == img0(0, 3), "Iterator2D");
+    it.arriba();
+    CHECK_TRUE(it.esta_fuera() and *it == img0(0, 3), "Iterator2D");
+}
+
+
+int main()
+{
+try{
+
+    test::header("img_padded.h");
+    img::num_threads(4);
+
+    test_relleno();
+    test_vecinos();
+
+}catch(const std::exception& e){
+    std::cerr << e.what() << '\n';
+    return 1;
+}
+
+    return 0;
+}
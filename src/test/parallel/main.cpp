@@ -0,0 +1,73 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "../../img_parallel.h"
+
+#include <alp_test.h>
+
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+
+using namespace test;
+
+void test_parallel_for()
+{
+    test::interfaz("parallel_for");
+
+    std::atomic<long long> suma{0};
+    img::parallel_for(1000, [&](img::Ind i0, img::Ind ie){
+	for (img::Ind i = i0; i < ie; ++i)
+	    suma += i;
+    }, img::parallel_min_elementos);
+    CHECK_TRUE(suma == 999 * 1000 / 2, "suma");
+
+    // Excepciones en cualquier banda (también en la del hilo que llama)
+    for (img::Ind banda_mala: {0, 3}){
+	std::atomic<int> terminadas{0};
+	bool lanza = false;
+	try{
+	    img::parallel_for(4, [&](img::Ind i0, img::Ind){
+		if (i0 == banda_mala)
+		    throw std::runtime_error{"banda"};
+		++terminadas;
+	    }, img::parallel_min_elementos);
+	}
+	catch(const std::runtime_error&) { lanza = true; }
+
+	CHECK_TRUE(lanza and terminadas == 3, "excepción");
+    }
+}
+
+
+int main()
+{
+try{
+
+    test::header("img_parallel.h");
+    img::num_threads(4);
+
+    test_parallel_for();
+
+}catch(const std::exception& e){
+    std::cerr << e.what() << '\n';
+    return 1;
+}
+
+    return 0;
+}
@@ -0,0 +1,202 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "../../img_quality.h"
+
+#include <alp_test.h>
+
+#include <iostream>
+#include <cmath>
+#include <random>
+
+using namespace test;
+
+using img::ColorRGB;
+
+// img0 + ruido uniforme en [-a, a]
+static img::Image con_ruido(const img::Image& img0, int a, unsigned semilla)
+{
+    std::mt19937 g{semilla};
+    std::uniform_int_distribution<int> d{-a, a};
+
+    img::Image res = img0;
+    for (auto& p: res)
+	p = ColorRGB{std::clamp(p.r + d(g), 0, 255),
+		     std::clamp(p.g + d(g), 0, 255),
+		     std::clamp(p.b + d(g), 0, 255)};
+
+    return res;
+}
+
+static bool cerca(double x, double y, double eps = 1e-9)
+{ return std::abs(x - y) <= eps; }
+
+
+// SSIM calculado directamente, ventana a ventana
+static double ssim_directo(const img::Plane<int>& a, const img::Plane<int>& b,
+			   int lado)
+{
+    const double C1 = 6.5025, C2 = 58.5225;
+    double total = 0;
+    int n = 0;
+    for (int i = 0; i + lado <= a.rows(); ++i)
+	for (int j = 0; j + lado <= a.cols(); ++j){
+	    double mx = 0, my = 0;
+	    for (int k = 0; k < lado; ++k)
+		for (int l = 0; l < lado; ++l){
+		    mx += a(i + k, j + l);
+		    my += b(i + k, j + l);
+		}
+	    mx /= lado * lado;
+	    my /= lado * lado;
+
+	    double vx = 0, vy = 0, cxy = 0;
+	    for (int k = 0; k < lado; ++k)
+		for (int l = 0; l < lado; ++l){
+		    double x = a(i + k, j + l) - mx;
+		    double y = b(i + k, j + l) - my;
+		    vx += x * x;
+		    vy += y * y;
+		    cxy += x * y;
+		}
+	    vx /= lado * lado;
+	    vy /= lado * lado;
+	    cxy /= lado * lado;
+
+	    total += (2*mx*my + C1) * (2*cxy + C2) /
+		     ((mx*mx + my*my + C1) * (vx + vy + C2));
+	    ++n;
+	}
+
+    return total / n;
+}
+
+
+void test_mse()
+{
+    test::interfaz("mse/psnr");
+
+    img::Image a{100, 120};
+    for (int i = 0; i < 100; ++i)
+	for (int j = 0; j < 120; ++j)
+	    a(i, j) = ColorRGB{50 + i, 50 + j, 128};
+    CHECK_TRUE(img::mse(a, a) == 0.0 and std::isinf(img::psnr(a, a)), "mse(iguales)");
+
+    img::Image b = a;
+    b(10, 10).r += 10;	    // 100
+    b(20, 30).g -= 20;	    // 400
+    CHECK_TRUE(cerca(img::mse(a, b), 500.0 / (3 * 100 * 120)), "mse");
+    CHECK_TRUE(cerca(img::psnr(a, b),
+		     10 * std::log10(255.0 * 255.0 / (500.0 / 36000))), "psnr");
+
+    // Un canal
+    auto ra = img::const_imagen_red(a);
+    auto rb = img::const_imagen_red(b);
+    CHECK_TRUE(cerca(img::mse(ra, rb), 100.0 / (100 * 120)), "mse(canal)");
+
+    CHECK_TRUE(cerca(img::psnr(1.0), 10 * std::log10(65025.0)), "psnr(e)");
+}
+
+
+void test_ssim()
+{
+    test::interfaz("ssim");
+
+    // Textura con detalle a todas las escalas: el ruido cambia la estructura
+    img::Image a{90, 110};
+    for (int i = 0; i < 90; ++i)
+	for (int j = 0; j < 110; ++j)
+	    a(i, j) = ColorRGB{(i * 7) % 256, (j * 3) % 256, (i * j) % 256};
+    img::Image b = con_ruido(a, 20, 1);
+    img::Image c = con_ruido(a, 60, 2);
+
+    CHECK_TRUE(cerca(img::ssim(a, a), 1.0), "ssim(iguales)");
+
+    double sb = img::ssim(a, b);
+    double sc = img::ssim(a, c);
+    CHECK_TRUE(sb < 1.0 and sc < sb, "ssim(ruido)");
+
+    // Comparamos con el cálculo directo
+    img::Plane<int> pa{a.rows(), a.cols()}, pb{a.rows(), a.cols()};
+    for (int i = 0; i < a.rows(); ++i)
+	for (int j = 0; j < a.cols(); ++j){
+	    pa(i, j) = a(i, j).g;
+	    pb(i, j) = b(i, j).g;
+	}
+    CHECK_TRUE(cerca(img::ssim(pa, pb, 7), ssim_directo(pa, pb, 7), 1e-9),
+	       "ssim(plano)");
+    CHECK_TRUE(cerca(img::ssim(img::const_imagen_green(a),
+			       img::const_imagen_green(b)),
+		     ssim_directo(pa, pb, 8), 1e-9), "ssim(canal)");
+
+    bool lanza = false;
+    try{ img::ssim(pa, pb, 200); }
+    catch(const std::logic_error&) { lanza = true; }
+    CHECK_TRUE(lanza, "ssim(ventana grande)");
+}
+
+
+void test_ms_ssim()
+{
+    test::interfaz("ms_ssim");
+
+    img::Image a{256, 256};
+    for (int i = 0; i < 256; ++i)
+	for (int j = 0; j < 256; ++j)
+	    a(i, j) = ColorRGB{(i * 7) % 256, (j * 3) % 256, (i * j) % 256};
+    img::Image b = con_ruido(a, 20, 3);
+    img::Image c = con_ruido(a, 60, 4);
+
+    CHECK_TRUE(cerca(img::ms_ssim(a, a), 1.0), "ms_ssim(iguales)");
+
+    double mb = img::ms_ssim(a, b);
+    double mc = img::ms_ssim(a, c);
+    CHECK_TRUE(0.0 < mc and mc < mb and mb < 1.0, "ms_ssim(ruido)");
+
+    // Con una escala es SSIM
+    CHECK_TRUE(cerca(img::ms_ssim(a, b, 8, 1), img::ssim(a, b)), "ms_ssim(1)");
+
+    // El ruido de alta frecuencia afecta menos en las escalas gruesas
+    CHECK_TRUE(mb > img::ssim(a, b), "ms_ssim > ssim");
+
+    // Imagen pequeña: menos escalas
+    img::Image p{20, 20};
+    for (auto& x: p)
+	x = ColorRGB{90, 160, 30};
+    CHECK_TRUE(cerca(img::ms_ssim(p, p), 1.0), "ms_ssim(pequeña)");
+}
+
+
+int main()
+{
+try{
+
+    test::header("img_quality.h");
+    img::num_threads(4);
+
+    test_mse();
+    test_ssim();
+    test_ms_ssim();
+
+}catch(const std::exception& e){
+    std::cerr << e.what() << '\n';
+    return 1;
+}
+
+    return 0;
+}
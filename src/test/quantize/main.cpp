@@ -0,0 +1,200 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "../../img_quantize.h"
+#include "../../img_parallel.h"
+
+#include <alp_test.h>
+
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+
+using namespace test;
+
+using img::ColorRGB;
+
+static int dist2(const ColorRGB& a, const ColorRGB& b)
+{
+    int dr = a.r - b.r, dg = a.g - b.g, db = a.b - b.b;
+    return dr*dr + dg*dg + db*db;
+}
+
+// Imagen con n colores distintos en franjas verticales
+static img::Image franjas(int rows, int cols, const std::vector<ColorRGB>& cs)
+{
+    img::Image img0{rows, cols};
+    for (int i = 0; i < rows; ++i)
+	for (int j = 0; j < cols; ++j)
+	    img0(i, j) = cs[(j * cs.size()) / cols];
+
+    return img0;
+}
+
+// Error cuadrático medio entre img0 y su reconstrucción
+static double error(const img::Image& img0, const img::Imagen_indexada& x)
+{
+    img::Image img1 = img::reconstruye(x);
+    double e = 0;
+    for (int i = 0; i < img0.rows(); ++i)
+	for (int j = 0; j < img0.cols(); ++j)
+	    e += dist2(img0(i, j), img1(i, j));
+
+    return e / (img0.rows() * img0.cols());
+}
+
+
+void test_pocos_colores()
+{
+    test::interfaz("paleta");
+
+    std::vector<ColorRGB> cs = {ColorRGB{255, 0, 0}, ColorRGB{0, 255, 0},
+				ColorRGB{10, 20, 30}, ColorRGB{200, 200, 200},
+				ColorRGB{12, 20, 30}};  // misma celda que el 3º
+
+    img::Image img0 = franjas(40, 100, cs);
+
+    for (auto q: {img::Cuantizador::median_cut, img::Cuantizador::octree}){
+	// Hay menos colores que los pedidos: la paleta los contiene todos
+	// (salvo los que caen en la misma celda, que se promedian)
+	img::Imagen_indexada x = img::cuantiza(img0, 16, q);
+	CHECK_TRUE(x.paleta.size() == 4, "cuantiza(pocos colores)");
+	CHECK_TRUE(error(img0, x) <= 1.0, "cuantiza(pocos colores)");
+
+	x = img::cuantiza(img0, 2, q);
+	CHECK_TRUE(x.paleta.size() <= 2 and x.paleta.size() >= 1, "cuantiza(2)");
+
+	x = img::cuantiza(img0, 1, q);
+	CHECK_TRUE(x.paleta.size() == 1, "cuantiza(1)");
+    }
+
+    // Imagen vacía
+    img::Image vacia{0, 0};
+    img::Imagen_indexada x = img::cuantiza(vacia, 8);
+    CHECK_TRUE(x.paleta.empty() and x.indices.rows() == 0, "cuantiza(vacía)");
+}
+
+
+void test_tabla()
+{
+    test::interfaz("Tabla_paleta");
+
+    img::Paleta p;
+    for (int r = 0; r < 256; r += 51)
+	for (int g = 0; g < 256; g += 51)
+	    for (int b = 0; b < 256; b += 85)
+		p.push_back(ColorRGB{r, g, b});
+
+    img::Tabla_paleta t{p};
+
+    // La tabla es exacta salvo por la cuantización a celdas de 8: el color
+    // que devuelve está como mucho a la distancia del mejor más la
+    // diagonal de una celda.
+    bool ok = true;
+    for (int r = 0; r < 256; r += 3)
+	for (int g = 0; g < 256; g += 5)
+	    for (int b = 0; b < 256; b += 7){
+		ColorRGB c{r, g, b};
+		int mejor = dist2(c, p[0]);
+		for (const ColorRGB& x: p)
+		    mejor = std::min(mejor, dist2(c, x));
+
+		double d = std::sqrt(dist2(c, t.color(t(c))));
+		if (d > std::sqrt(mejor) + 14.0)
+		    ok = false;
+	    }
+    CHECK_TRUE(ok, "Tabla_paleta");
+
+    CHECK_TRUE(t(ColorRGB{-20, 300, 0}) == t(ColorRGB{0, 255, 0}),
+	       "Tabla_paleta(fuera de rango)");
+}
+
+
+void test_cuantiza()
+{
+    test::interfaz("cuantiza");
+
+    // Degradado suave en los 3 canales: con pocos colores aparecen bandas
+    // que el tramado tiene que disimular
+    img::Image img0{300, 400};
+    for (int i = 0; i < 300; ++i)
+	for (int j = 0; j < 400; ++j)
+	    img0(i, j) = ColorRGB{(i * 255) / 300, (j * 255) / 400,
+				  ((i + j) * 127) / 700};
+
+    for (auto q: {img::Cuantizador::median_cut, img::Cuantizador::octree}){
+	img::Imagen_indexada x16 = img::cuantiza(img0, 16, q);
+	img::Imagen_indexada x256 = img::cuantiza(img0, 256, q);
+
+	CHECK_TRUE(x16.paleta.size() <= 16 and x256.paleta.size() <= 256,
+		   "cuantiza");
+	CHECK_TRUE(error(img0, x256) < error(img0, x16), "cuantiza(error)");
+	CHECK_TRUE(error(img0, x256) < 100.0, "cuantiza(error)");
+
+	// Tramado: el color medio de una zona se parece más al original
+	for (auto t: {img::Tramado::ordenado, img::Tramado::difusion}){
+	    img::Image img1 = img::reconstruye(
+		    img::Imagen_indexada{x16.paleta,
+					 img::indexa(img0, x16.paleta, t)});
+	    img::Image img2 = img::reconstruye(x16);
+
+	    // media en bloques de 16 x 16
+	    double e1 = 0, e2 = 0;
+	    for (int i = 0; i < 288; i += 16)
+		for (int j = 0; j < 384; j += 16){
+		    double s0 = 0, s1 = 0, s2 = 0;
+		    for (int a = 0; a < 16; ++a)
+			for (int b = 0; b < 16; ++b){
+			    s0 += img0(i + a, j + b).g;
+			    s1 += img1(i + a, j + b).g;
+			    s2 += img2(i + a, j + b).g;
+			}
+		    e1 += std::abs(s1 - s0) / 256;
+		    e2 += std::abs(s2 - s0) / 256;
+		}
+	    CHECK_TRUE(e1 < e2, "indexa(tramado)");
+	}
+    }
+
+    // Subimage
+    img::Subimage sb{img0, img::Position{100, 50}, img::Size2D{60, 70}};
+    img::Imagen_indexada x = img::cuantiza(sb, 8, img::Cuantizador::octree,
+					   img::Tramado::difusion);
+    CHECK_TRUE(x.indices.rows() == 60 and x.indices.cols() == 70 and
+	       x.paleta.size() <= 8, "cuantiza(Subimage)");
+}
+
+
+int main()
+{
+try{
+
+    test::header("img_quantize.h");
+    img::num_threads(4);
+
+    test_pocos_colores();
+    test_tabla();
+    test_cuantiza();
+
+}catch(const std::exception& e){
+    std::cerr << e.what() << '\n';
+    return 1;
+}
+
+    return 0;
+}
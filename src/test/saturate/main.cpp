@@ -0,0 +1,168 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "../../img_saturate.h"
+#include "../../img_view.h"
+
+#include <alp_test.h>
+
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+using namespace test;
+
+using img::ColorRGB;
+
+// Imagen con valores en [-100, 355]
+static img::Image fuera_del_cubo(int rows, int cols)
+{
+    img::Image img0{rows, cols};
+    for (int i = 0; i < rows; ++i)
+	for (int j = 0; j < cols; ++j)
+	    img0(i, j) = ColorRGB{(i * 7) % 456 - 100, (j * 5) % 456 - 100,
+							    (i + j) % 256};
+
+    return img0;
+}
+
+
+static img::Image constante(int rows, int cols, const ColorRGB& c)
+{
+    img::Image img0{rows, cols};
+    for (auto& p: img0)
+	p = c;
+
+    return img0;
+}
+
+
+void test_satura()
+{
+    test::interfaz("satura");
+
+    img::Image img0 = fuera_del_cubo(300, 400);
+    CHECK_TRUE(!img::esta_en_rango(img0), "esta_en_rango(no)");
+
+    img::Image img1 = img0;
+    img::satura(img1);
+    CHECK_TRUE(img::esta_en_rango(img1), "esta_en_rango(si)");
+
+    bool ok = true;
+    for (int i = 0; i < img0.rows(); ++i)
+	for (int j = 0; j < img0.cols(); ++j){
+	    ColorRGB c = img0(i, j);
+	    ColorRGB esperado{std::clamp(c.r, 0, 255), std::clamp(c.g, 0, 255),
+			      std::clamp(c.b, 0, 255)};
+	    if (img1(i, j) != esperado)
+		ok = false;
+	}
+    CHECK_TRUE(ok, "satura");
+
+    // Un solo canal
+    img::Image img2 = img0;
+    img::satura(img::imagen_red(img2));
+    CHECK_TRUE(img2(0, 0).r == 0 and img2(0, 0).g == -100, "satura(canal)");
+
+    // Un pixel fuera
+    img::Image img3 = constante(10, 10, ColorRGB{10, 20, 30});
+    CHECK_TRUE(img::esta_en_rango(img3), "esta_en_rango(1)");
+    img3(9, 9).b = 256;
+    CHECK_TRUE(!img::esta_en_rango(img3), "esta_en_rango(2)");
+}
+
+
+void test_reescala()
+{
+    test::interfaz("rango/reescala");
+
+    img::Image img0 = fuera_del_cubo(300, 400);
+    img::Rango_rgb r = img::rango(img0);
+    CHECK_TRUE(r.min == (ColorRGB{-100, -100, 0}) and 
+	       r.max == (ColorRGB{355, 355, 255}), "rango");
+
+    // global: -100 -> 0, 355 -> 255
+    img::Image img1 = img0;
+    img::reescala(img1);
+    r = img::rango(img1);
+    CHECK_TRUE(r.min == (ColorRGB{0, 0, 56}) and r.max == (ColorRGB{255, 255, 199}),
+	       "reescala(global)");
+    CHECK_TRUE(img::esta_en_rango(img1), "reescala(esta_en_rango)");
+
+    // por canal
+    img::Image img2 = img0;
+    img::reescala(img2, img::Reescalado::por_canal, 10, 20);
+    r = img::rango(img2);
+    CHECK_TRUE(r.min == (ColorRGB{10, 10, 10}) and r.max == (ColorRGB{20, 20, 20}),
+	       "reescala(por_canal)");
+
+    // Es lineal: el valor medio va al centro
+    img::Image img3 = constante(2, 2, ColorRGB{0, 0, 0});
+    img3(0, 0) = ColorRGB{-50, 0, 50};
+    img3(1, 1) = ColorRGB{150, 100, 150};
+    img::reescala(img3, img::Reescalado::global, 0, 200);
+    CHECK_TRUE(img3(0, 0) == (ColorRGB{0, 50, 100}) and
+	       img3(1, 1) == (ColorRGB{200, 150, 200}), "reescala(lineal)");
+
+    // Constante
+    img::Image img4 = constante(5, 5, ColorRGB{300, 300, 300});
+    img::reescala(img4);
+    CHECK_TRUE(img4(2, 2) == (ColorRGB{0, 0, 0}), "reescala(constante)");
+
+    // Rangos grandes: no se pierde precisión ni se desborda
+    img::Image img5 = constante(1, 3, ColorRGB{0, 0, 0});
+    img5(0, 1).r = 400000;
+    img5(0, 2).r = 1000000;
+    img::reescala(img5, img::Reescalado::por_canal);
+    CHECK_TRUE(img5(0, 0).r == 0 and img5(0, 1).r == 102 and 
+	       img5(0, 2).r == 255, "reescala(rango grande)");
+
+    constexpr int imin = std::numeric_limits<int>::min();
+    constexpr int imax = std::numeric_limits<int>::max();
+    img::Image img6 = constante(1, 3, ColorRGB{0, 0, 0});
+    img6(0, 0) = ColorRGB{imin, imin, imin};
+    img6(0, 2) = ColorRGB{imax, imax, imax};
+    img::reescala(img6);
+    CHECK_TRUE(img6(0, 0) == (ColorRGB{0, 0, 0}) and
+	       img6(0, 1) == (ColorRGB{128, 128, 128}) and
+	       img6(0, 2) == (ColorRGB{255, 255, 255}), "reescala(int completo)");
+
+    bool lanza = false;
+    try{ img::reescala(img6, img::Reescalado::global, 20, 10); }
+    catch(const std::logic_error&) { lanza = true; }
+    CHECK_TRUE(lanza, "reescala(a > b)");
+}
+
+
+int main()
+{
+try{
+
+    test::header("img_saturate.h");
+    img::num_threads(4);
+
+    test_satura();
+    test_reescala();
+
+}catch(const std::exception& e){
+    std::cerr << e.what() << '\n';
+    return 1;
+}
+
+    return 0;
+}
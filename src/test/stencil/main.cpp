@@ -0,0 +1,246 @@
+// Copyright (C) 2026 Manuel Perez <manuel2perez@proton.me>
+//
+// This file is part of the ALP Library.
+//
+// ALP Library is a free library: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "../../img_stencil.h"
+#include "../../img_gradient.h"
+#include "../../img_view.h"
+
+#include <alp_test.h>
+
+#include <iostream>
+#include <algorithm>
+#include <array>
+#include <atomic>
+
+using namespace test;
+
+using img::ColorRGB;
+using img::Ind;
+using img::Position;
+
+static img::Plane<int> plano(int rows, int cols)
+{
+    img::Plane<int> p{rows, cols};
+    for (Ind i = 0; i < rows; ++i)
+	for (Ind j = 0; j < cols; ++j)
+	    p(i, j) = (i * 31 + j * 17 + i * j) % 97;
+
+    return p;
+}
+
+static bool iguales(const img::Plane<int>& a, const img::Plane<int>& b)
+{
+    for (Ind i = 0; i < a.rows(); ++i)
+	for (Ind j = 0; j < a.cols(); ++j)
+	    if (a(i, j) != b(i, j))
+		return false;
+
+    return true;
+}
+
+
+void test_vecindad()
+{
+    test::interfaz("Vecindad");
+
+    img::Plane<int> p = plano(6, 7);
+    img::Vecindad v{&p(2, 3), 7, 1, Position{2, 3}};
+    CHECK_TRUE(v.lado() == 3 and v.centro() == p(2, 3) and 
+	       v(-1, -1) == p(1, 2) and v(1, 1) == p(3, 4) and
+	       v.fila(1)[-1] == p(3, 2), "Vecindad");
+
+    ++v;
+    CHECK_TRUE(v.posicion() == (Position{2, 4}) and v(0, 1) == p(2, 5) and
+	       v(-1, 0) == p(1, 4), "operator++");
+}
+
+
+void test_interior()
+{
+    test::interfaz("para_cada_vecindad(interior)");
+
+    // Erosión 5 x 5 (mínimo) solo donde cabe la ventana
+    img::Plane<int> p = plano(300, 400);   // varios hilos
+    img::Plane<int> res{p.rows(), p.cols()};
+    for (auto& x: res)
+	x = -1;
+
+    std::atomic<int> n{0};
+    img::para_cada_vecindad(std::as_const(p), 2, 
+	[&](const img::Vecindad<const int>& v){
+	    int m = v(0, 0);
+	    for (Ind di = -2; di <= 2; ++di){
+		const int* f = v.fila(di);
+		for (Ind dj = -2; dj <= 2; ++dj)
+		    m = std::min(m, f[dj]);
+	    }
+	    res(v.posicion().i, v.posicion().j) = m;
+	    ++n;
+	});
+
+    CHECK_TRUE(n == 296 * 396, "número de ventanas");
+
+    bool ok = true;
+    for (Ind i = 0; i < p.rows(); ++i)
+	for (Ind j = 0; j < p.cols(); ++j){
+	    bool dentro = 2 <= i and i < 298 and 2 <= j and j < 398;
+	    if (!dentro){
+		if (res(i, j) != -1)
+		    ok = false;
+		continue;
+	    }
+
+	    int m = p(i, j);
+	    for (Ind di = -2; di <= 2; ++di)
+		for (Ind dj = -2; dj <= 2; ++dj)
+		    m = std::min(m, p(i + di, j + dj));
+	    if (m != res(i, j))
+		ok = false;
+	}
+    CHECK_TRUE(ok, "erosión");
+
+    // Subimage: los vecinos son los de la imagen
+    img::Image img0{20, 30};
+    for (Ind i = 0; i < 20; ++i)
+	for (Ind j = 0; j < 30; ++j)
+	    img0(i, j) = ColorRGB{i, j, 0};
+
+    img::Subimage sb{img0, Position{5, 10}, img::Size2D{4, 6}};
+    int sumas = 0;
+    img::para_cada_vecindad(sb, 1, [&](const img::Vecindad<ColorRGB>& v){
+	if (v.posicion() == (Position{1, 1}))
+	    sumas = v(-1, -1).r + v(-1, -1).g + v(1, 1).r + v(1, 1).g;
+    }, 0, 4);
+    CHECK_TRUE(sumas == (5 + 10) + (7 + 12), "Subimage");
+
+    // No cabe la ventana
+    n = 0;
+    img::Plane<int> q = plano(2, 10);
+    img::para_cada_vecindad(q, 1, [&](const auto&) { ++n; });
+    CHECK_TRUE(n == 0, "ventana mayor que la imagen");
+
+    // Vista de un canal: las columnas están cada 3 int
+    auto green = img::imagen_green(img0);
+    static_assert(img::Con_vecindades<decltype(green)>);
+    static_assert(decltype(img::impl_of::recorrido_vecindad(green, 1))
+					    ::Ventana::salto_columna() == 3);
+    n = 0;
+    ok = true;
+    img::para_cada_vecindad(green, 1, [&](const auto& v){
+	Position p = v.posicion();
+	ok = ok and v(0, 0) == p.j and v(-1, 1) == p.j + 1 and 
+	     v(1, -1) == p.j - 1;
+	++n;
+    }, 0, 20);
+    CHECK_TRUE(ok and n == 18 * 28, "vista");
+
+    // Una vista cualquiera no tiene por qué ser afín: no compila
+    auto r2 = img::imagen_view(img0, [](ColorRGB& c) -> int& {return c.r;});
+    static_assert(!img::Con_vecindades<decltype(r2)>);
+}
+
+
+void test_con_borde()
+{
+    test::interfaz("para_cada_vecindad(con borde)");
+
+    img::Plane<int> p = plano(50, 70);
+
+    // Sobel con el borde repetido = gradiente_x
+    const img::Plane_con_borde<int> pb{p, 1};
+    img::Plane<int> gx{p.rows(), p.cols()};
+    img::para_cada_vecindad(pb, 1, [&](const img::Vecindad<const int>& v){
+	const int* a = v.fila(-1);
+	const int* b = v.fila(0);
+	const int* c = v.fila(1);
+	gx(v.posicion().i, v.posicion().j) = 
+		(a[1] - a[-1]) + 2 * (b[1] - b[-1]) + (c[1] - c[-1]);
+    });
+    CHECK_TRUE(iguales(gx, img::gradiente_x(p, img::Tipo_gradiente::sobel)),
+								"sobel");
+
+    // Mediana 3 x 3 de una imagen (espejo)
+    img::Image img0{30, 40};
+    for (Ind i = 0; i < 30; ++i)
+	for (Ind j = 0; j < 40; ++j)
+	    img0(i, j) = ColorRGB{(i * j) % 256, (i + 3 * j) % 256, 0};
+
+    img::Image_con_borde img1{img0, 2, img::Relleno_borde::espejo};
+    img::Image res{30, 40};
+    img::para_cada_vecindad(std::as_const(img1), 1, 
+	[&](const img::Vecindad<const ColorRGB>& v){
+	    std::array<int, 9> r;
+	    int n = 0;
+	    for (Ind di = -1; di <= 1; ++di)
+		for (Ind dj = -1; dj <= 1; ++dj)
+		    r[n++] = v(di, dj).r;
+	    std::nth_element(r.begin(), r.begin() + 4, r.end());
+	    res(v.posicion().i, v.posicion().j) = ColorRGB{r[4], 0, 0};
+	});
+
+    auto espejo = [](Ind i, Ind n) { return i < 0? -i: (i >= n? 2*n - 2 - i: i); };
+    bool ok = true;
+    for (Ind i = 0; i < 30; ++i)
+	for (Ind j = 0; j < 40; ++j){
+	    std::array<int, 9> r;
+	    int n = 0;
+	    for (Ind di = -1; di <= 1; ++di)
+		for (Ind dj = -1; dj <= 1; ++dj)
+		    r[n++] = img0(espejo(i + di, 30), espejo(j + dj, 40)).r;
+	    std::nth_element(r.begin(), r.begin() + 4, r.end());
+	    if (res(i, j).r != r[4])
+		ok = false;
+	}
+    CHECK_TRUE(ok, "mediana");
+
+    // Bandas a mano: el mismo resultado
+    img::Plane<int> gx2{p.rows(), p.cols()};
+    auto f = [&](const img::Vecindad<const int>& v){
+	gx2(v.posicion().i, v.posicion().j) = 
+		(v(-1, 1) - v(-1, -1)) + 2 * (v(0, 1) - v(0, -1)) +
+		(v(1, 1) - v(1, -1));
+    };
+    img::para_cada_vecindad(pb, 1, f, 0, 20);
+    img::para_cada_vecindad(pb, 1, f, 20, 50);
+    CHECK_TRUE(iguales(gx, gx2), "bandas");
+
+    bool lanza = false;
+    try{ img::para_cada_vecindad(pb, 2, f); }
+    catch(const std::logic_error&) { lanza = true; }
+    CHECK_TRUE(lanza, "borde < radio");
+}
+
+
+int main()
+{
+try{
+
+    test::header("img_stencil.h");
+    img::num_threads(4);
+
+    test_vecindad();
+    test_interior();
+    test_con_borde();
+
+}catch(const std::exception& e){
+    std::cerr << e.what() << '\n';
+    return 1;
+}
+
+    return 0;
+}
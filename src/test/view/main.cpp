@@ -319,6 +319,103 @@ void test_image_as_array()
     for (int i = 0; i < v.size(); ++i)
 	CHECK_TRUE(v[i] == i, "operator[]");
 
+    CHECK_TRUE(img0(1, 2) == (img::ColorRGB{21, 22, 23}), "operator[]");
+
+    // Iteradores y span
+    int n = 0;
+    for (int& x: v)
+	x = 2 * n++;
+    CHECK_TRUE(n == v.size() and v.end() - v.begin() == v.size(), "begin/end");
+    CHECK_TRUE(img0(3, 4) == (img::ColorRGB{114, 116, 118}), "begin/end");
+
+    std::span<int> s = v.span();
+    CHECK_TRUE(s.size() == 60 and s[59] == 118, "span");
+
+    // const
+    const img::Image& cimg = img0;
+    img::const_Image_as_array cv{cimg};
+    CHECK_TRUE(cv.size() == 60 and cv[3] == 6 and *(cv.end() - 1) == 118,
+						    "const_Image_as_array");
+    CHECK_TRUE(std::accumulate(cv.begin(), cv.end(), 0) == 59 * 60, "accumulate");
+
+    // Subimage
+    img::Subimage sub{img0, img::Position{1, 2}, img::Size2D{2, 3}};
+    img::Image_as_array_base<img::Subimage> sv{sub};
+    CHECK_TRUE(sv.size() == 18 and sv.rows() == 2 and sv.tam_fila() == 9,
+							    "Subimage");
+    CHECK_TRUE(sv[0] == img0(1, 2).r and sv[8] == img0(1, 4).b and
+	       sv[9] == img0(2, 2).r and sv[17] == img0(2, 4).b, "Subimage");
+
+    // Iteradores de Subimage: recorren las filas sin dividir
+    static_assert(std::random_access_iterator<decltype(sv.begin())>);
+    int suma = 0;
+    for (int x: sv)
+	suma += x;
+    CHECK_TRUE(suma == std::accumulate(sv.fila(0).begin(), sv.fila(0).end(), 0)
+		     + std::accumulate(sv.fila(1).begin(), sv.fila(1).end(), 0)
+		     and sv.end() - sv.begin() == 18, "Subimage(begin/end)");
+
+    auto it = sv.begin() + 10;
+    CHECK_TRUE(*it == sv[10] and it[7] == sv[17] and *(sv.end() - 1) == sv[17]
+	       and *(--sv.end()) == sv[17] and (it - 10) == sv.begin()
+	       and it[-1] == sv[9] and it < sv.end(), "Subimage(iterador)");
+
+    for (int& x: sv.fila(1))
+	x = -1;
+    CHECK_TRUE(img0(2, 2) == (img::ColorRGB{-1, -1, -1}) and
+	       img0(2, 4) == (img::ColorRGB{-1, -1, -1}) and
+	       img0(2, 1).r != -1, "fila");
+
+    img::Image vacia{0, 0};
+    CHECK_TRUE(img::Image_as_array{vacia}.size() == 0, "vacía");
+}
+
+void test_filas_con_salto()
+{
+    test::interfaz("fila_con_salto");
+
+    img::Image img0{4, 5};
+    int n = 0;
+    for (auto& p: img0){
+	p = img::ColorRGB{n, 100 + n, 200 + n};
+	++n;
+    }
+
+    auto red = img::imagen_red(img0);
+    auto green = img::const_imagen_green(img0);
+    img::Plane<int> plano{3, 7};
+
+    static_assert(img::Filas_con_salto<decltype(red)>);
+    static_assert(img::Filas_con_salto<decltype(green)>);
+    static_assert(img::Filas_con_salto<img::Plane<int>>);
+    static_assert(!img::Filas_con_salto<img::Image>);
+
+    // Solo las vistas declaradas: otra vista que devuelve referencias no
+    // tiene por qué ser afín.
+    auto r2 = img::imagen_view(img0, [](img::ColorRGB& c) -> int& {return c.r;});
+    static_assert(!img::Filas_con_salto<decltype(r2)>);
+
+    auto f = img::fila_con_salto(red, 2);
+    CHECK_TRUE(f.size() == 5 and f.salto() == 3 and f[0] == 10 and f[4] == 14,
+							    "fila_con_salto");
+    f[1] = -1;
+    CHECK_TRUE(img0(2, 1).r == -1 and img0(2, 1).g == 111, "fila_con_salto");
+
+    auto fg = img::fila_con_salto(green, 3);
+    CHECK_TRUE(fg.salto() == 3 and fg[2] == 117, "fila_con_salto(const)");
+
+    CHECK_TRUE(img::fila_con_salto(plano, 1).es_contigua(), "es_contigua");
+
+    int suma = 0;
+    img::para_cada(img::fila_con_salto(green, 0), [&suma](int x) {suma += x;});
+    CHECK_TRUE(suma == 100 + 101 + 102 + 103 + 104, "para_cada");
+
+    // Vista de un canal de una Subimage
+    img::Subimage sb{img0, img::Position{1, 1}, img::Size2D{2, 3}};
+    auto blue = img::imagen_blue(sb);
+    img::para_cada(img::fila_con_salto(blue, 1), [](int& x) {x = 0;});
+    CHECK_TRUE(img0(2, 0).b == 210 and img0(2, 1).b == 0 and 
+	       img0(2, 3).b == 0 and img0(2, 4).b == 214, "Subimage");
 }
 
 int main()
@@ -329,6 +426,7 @@ try{
     test_imagen_xy();
     test_imagen_view_and_subimagen();
     test_image_as_array();
+    test_filas_con_salto();
 
 }catch(std::exception& e){
     std::cerr << "EXCEPTION: " << e.what() << '\n';